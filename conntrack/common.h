@@ -24,7 +24,9 @@
 
 #include "headers/ether.h"
 #include "headers/ip.h"
+#include "headers/ipv6.h"
 #include "headers/tcp.h"
+#include "headers/udp.h"
 
 #include "runtime/config.h"
 #include "runtime/worker.h"
@@ -72,7 +74,11 @@ using utils::unsafe_intrusive_ref_counter;
 // header
 using headers::Ethernet;
 using headers::Ipv4;
+using headers::Ipv6;
 using headers::Tcp;
+using headers::Udp;
+using headers::is_ipv4_v;
+using headers::ToIpAddress;
 using headers::ToIpv4Address;
 
 }  // namespace xlb
@@ -239,14 +239,23 @@ constexpr char *const tcp_conntrack_names[] = {
     "CLOSE_WAIT", "LAST_ACK", "TIME_WAIT", "CLOSE",       "SYN_SENT2",
 };
 
+inline uint16_t rtt_now() {
+  return W_TSC / (SvcMetrics::kRttUnit * utils::tsc_us);
+}
+
 }  // namespace
 
 tcp_bit_set get_conntrack_index(const Tcp *tcph) {
   return tcp_conntrack_indexes[tcph->flags];
 }
 
-std::pair<bool, tcp_conntrack> Conn::UpdateState(tcp_bit_set index,
-                                                 ip_conntrack_dir dir) {
+size_t max_conntrack_timeout() {
+  return *std::max_element(std::begin(tcp_timeouts), std::end(tcp_timeouts));
+}
+
+template <typename Addr>
+std::pair<bool, tcp_conntrack> BasicConn<Addr>::UpdateState(
+    tcp_bit_set index, ip_conntrack_dir dir) {
   DCHECK_NOTNULL(virt_);
   DCHECK_NOTNULL(real_);
 
@@ -259,19 +268,72 @@ std::pair<bool, tcp_conntrack> Conn::UpdateState(tcp_bit_set index,
       est = true;
       real_->IncrConns(1);
       virt_->IncrConns(1);
+    } else if (dir == IP_CT_DIR_REPLY && syn_sent()) {
+      // The real service answered the handshake with either SYN/ACK or RST
+      if (new_state == TCP_CONNTRACK_SYN_RECV) {
+        uint16_t rtt = rtt_now() - syn_ts_;
+        real_->IncrHandshakes(1);
+        real_->RecordRtt(rtt);
+        virt_->IncrHandshakes(1);
+        virt_->RecordRtt(rtt);
+      } else if (index == TCP_RST_SET) {
+        real_->IncrFailures(1);
+        virt_->IncrFailures(1);
+      }
+    } else if (index == TCP_SYN_SET && dir == IP_CT_DIR_ORIGINAL) {
+      // Retransmitted SYN restarts the measurement
+      syn_ts_ = rtt_now();
     }
     state_ = new_state;
     W_DVLOG(3) << "[Conn] state updated: " << *this;
     auto timeout = tcp_timeouts[state_] * tsc_hz;
-    CTABLE.timer_.ScheduleInRange(this, timeout, timeout + 100 * tsc_ms);
+    CTABLE_OF(Addr).timer_.ScheduleInRange(this, timeout,
+                                           timeout + 100 * tsc_ms);
   }
 
   return {est, new_state};
 }
 
-uint32_t Conn::index() const { return (this - &CTABLE.conns_[0]); }
+template <typename Addr>
+void BasicConn<Addr>::Refresh(tcp_bit_set index) {
+  DCHECK_NOTNULL(virt_);
+  DCHECK_NOTNULL(real_);
+
+  // Counted by the first packet since there is no handshake to follow
+  if (state_ == TCP_CONNTRACK_NONE) {
+    real_->IncrConns(1);
+    virt_->IncrConns(1);
+  }
+
+  switch (index) {
+    case TCP_RST_SET:
+      state_ = TCP_CONNTRACK_CLOSE;
+      break;
+    case TCP_FIN_SET:
+      state_ = TCP_CONNTRACK_FIN_WAIT;
+      break;
+    case TCP_SYN_SET:
+      // Reopened connection
+      state_ = TCP_CONNTRACK_ESTABLISHED;
+      break;
+    default:
+      if (state_ == TCP_CONNTRACK_NONE) state_ = TCP_CONNTRACK_ESTABLISHED;
+      break;
+  }
+
+  W_DVLOG(3) << "[Conn] state refreshed: " << *this;
+  auto timeout = tcp_timeouts[state_] * tsc_hz;
+  CTABLE_OF(Addr).timer_.ScheduleInRange(this, timeout,
+                                         timeout + 100 * tsc_ms);
+}
+
+template <typename Addr>
+uint32_t BasicConn<Addr>::index() const {
+  return (this - &CTABLE_OF(Addr).conns_[0]);
+}
 
-ip_conntrack_dir Conn::direction(Tuple4 &tuple) {
+template <typename Addr>
+ip_conntrack_dir BasicConn<Addr>::direction(Tuple4 &tuple) {
   // Need to make sure local ip is not used as vip, rsip or cip
   if (tuple.dst.ip == local_.ip)
     return IP_CT_DIR_REPLY;
@@ -279,20 +341,41 @@ ip_conntrack_dir Conn::direction(Tuple4 &tuple) {
     return IP_CT_DIR_ORIGINAL;
 }
 
-void Conn::execute(TimerWheel<Conn> *timer) {
+template <typename Addr>
+bool BasicConn<Addr>::Match(const Tuple4 &tuple) const {
+  return (tuple.src == client_ && tuple.dst == virt_->tuple()) ||
+         (tuple.src == real_->tuple() && tuple.dst == local_);
+}
+
+template <typename Addr>
+void BasicConn<Addr>::execute(TimerWheel<BasicConn> *timer) {
   W_DVLOG(2) << "[Conn] destructing: " << *this;
 
-  real_->PutLocal(local_);
+  // The real service never answered. Timeouts in SYN_RECV are not counted
+  // since the missing ACK is up to the client (e.g. SYN flood)
+  if (syn_sent()) {
+    real_->IncrFailures(1);
+    virt_->IncrFailures(1);
+  }
+
+  // There is no local tuple in DR mode, nor a reply entry in any mode but
+  // full-nat
+  if (forward() != Forward::kDr) real_->PutLocal(local_);
+  real_->DecrActiveConns();
+  virt_->DecrActiveConns();
 
-  CTABLE.idx_map_.Remove({client_, virt_->tuple()});
-  CTABLE.idx_map_.Remove({real_->tuple(), local_});
-  CTABLE.idx_pool_.push(index());
+  auto &table = CTABLE_OF(Addr);
+  table.idx_map_.Remove(table.key({client_, virt_->tuple()}));
+  if (forward() == Forward::kFullNat)
+    table.idx_map_.Remove(table.key({real_->tuple(), local_}));
+  table.idx_pool_.push(index());
 
   real_.reset();
   virt_.reset();
 }
 
-std::ostream &operator<<(std::ostream &os, const Conn &conn) {
+template <typename Addr>
+std::ostream &operator<<(std::ostream &os, const BasicConn<Addr> &conn) {
   os << "[client: " << conn.client_ << " virt: " << conn.virt_->tuple()
      << " local: " << conn.local_ << " real: " << conn.real_->tuple()
      << " state: " << tcp_conntrack_names[conn.state_]
@@ -300,4 +383,10 @@ std::ostream &operator<<(std::ostream &os, const Conn &conn) {
   return os;
 }
 
+template class BasicConn<be32_t>;
+template class BasicConn<Ipv6::Address>;
+
+template std::ostream &operator<<(std::ostream &os, const Conn &conn);
+template std::ostream &operator<<(std::ostream &os, const Ipv6Conn &conn);
+
 }  // namespace xlb::conntrack
@@ -6,6 +6,9 @@
 
 namespace xlb::conntrack {
 
+template <typename Addr>
+class BasicConnTable;
+
 // TODO: not to expose these
 
 enum ip_conntrack_dir : uint8_t {
@@ -43,43 +46,75 @@ enum tcp_bit_set : uint8_t {
 
 tcp_bit_set get_conntrack_index(const Tcp *tcph);
 
-class alignas(64) Conn : public EventBase<Conn> {
+// In seconds, the longest a connection of any state lives without packets
+size_t max_conntrack_timeout();
+
+template <typename Addr>
+class BasicConn;
+
+template <typename Addr>
+std::ostream &operator<<(std::ostream &os, const BasicConn<Addr> &conn);
+
+template <typename Addr>
+class alignas(64) BasicConn : public EventBase<BasicConn<Addr>> {
  public:
-  Conn() = default;
-  ~Conn() = default;
+  using Tuple2 = BasicTuple2<Addr>;
+  using Tuple4 = BasicTuple4<Addr>;
+  using RealSvc = BasicRealSvc<Addr>;
+  using VirtSvc = BasicVirtSvc<Addr>;
+
+  BasicConn() = default;
+  ~BasicConn() = default;
 
-  void execute(TimerWheel<Conn> *timer);
+  void execute(TimerWheel<BasicConn> *timer);
 
-  VirtSvc::Ptr &virt() { return virt_; }
-  RealSvc::Ptr &real() { return real_; }
+  typename VirtSvc::Ptr &virt() { return virt_; }
+  typename RealSvc::Ptr &real() { return real_; }
   Tuple2 &local() { return local_; }
   Tuple2 &client() { return client_; }
   tcp_conntrack &state() { return state_; }
+  Forward forward() const { return virt_->forward(); }
 
   // Here you need to ensure that the tuple belongs to this connection
   ip_conntrack_dir direction(Tuple4 &tuple);
+  // Whether the tuple of either direction belongs to this connection
+  bool Match(const Tuple4 &tuple) const;
 
   // Return true when conn first becomes established
   std::pair<bool, tcp_conntrack> UpdateState(tcp_bit_set index,
                                              ip_conntrack_dir dir);
+  // Only the original direction is seen in DR and tunnel modes, so the state
+  // is a rough guess from the client to choose the idle timeout
+  void Refresh(tcp_bit_set index);
 
  private:
   tcp_conntrack state_;
 
   Tuple2 client_;
   Tuple2 local_;
+  // When the last SYN was forwarded, in units of 'SvcMetrics::kRttUnit'
+  // microseconds (wraps about every 2 seconds)
+  uint16_t syn_ts_;
 
-  VirtSvc::Ptr virt_;
-  RealSvc::Ptr real_;
+  typename VirtSvc::Ptr virt_;
+  typename RealSvc::Ptr real_;
 
   inline uint32_t index() const;
+  bool syn_sent() const {
+    return state_ == TCP_CONNTRACK_SYN_SENT ||
+           state_ == TCP_CONNTRACK_SYN_SENT2;
+  }
 
-  friend inline std::ostream &operator<<(std::ostream &os, const Conn &conn);
+  friend std::ostream &operator<<<>(std::ostream &os, const BasicConn &conn);
 
-  friend class ConnTable;
+  friend class BasicConnTable<Addr>;
 };
 
+using Conn = BasicConn<be32_t>;
+using Ipv6Conn = BasicConn<Ipv6::Address>;
+
 static_assert(sizeof(EventBase<Conn>) == 32);
 static_assert(sizeof(Conn) == 64);
+static_assert(sizeof(Ipv6Conn) == 128);
 
 }  // namespace xlb::conntrack
@@ -0,0 +1,103 @@
+#include "conntrack/flow.h"
+
+namespace xlb::conntrack {
+
+uint32_t Flow::index() const { return (this - &UTABLE.flows_[0]); }
+
+void Flow::execute(TimerWheel<Flow> *timer) {
+  W_DVLOG(2) << "[Flow] expired: " << *this;
+
+  real_->PutLocal(local_);
+  real_->DecrActiveConns();
+  virt_->DecrActiveConns();
+
+  auto &table = UTABLE;
+  table.idx_map_.Remove({client_, virt_->tuple()});
+  table.idx_map_.Remove({real_->tuple(), local_});
+  table.idx_pool_.push(index());
+
+  real_.reset();
+  virt_.reset();
+}
+
+std::ostream &operator<<(std::ostream &os, const Flow &flow) {
+  os << "[client: " << flow.client_ << " virt: " << flow.virt_->tuple()
+     << " local: " << flow.local_ << " real: " << flow.real_->tuple()
+     << " index: " << flow.index() << "]";
+  return os;
+}
+
+Flow *FlowTable::Find(const Tuple4 &tuple) {
+  IdxMap::Entry *entry = idx_map_.Find(tuple);
+
+  if (entry == nullptr) return nullptr;
+
+  auto *flow = &flows_[entry->value];
+  refresh(flow);
+
+  return flow;
+}
+
+Flow *FlowTable::Get(VirtSvc::Ptr &vs_ptr, const Tuple2 &cli_tp,
+                     RealSvc::Ptr rs_ptr) {
+  // The table is full
+  if (unlikely(idx_pool_.empty())) return nullptr;
+
+  if (!rs_ptr) rs_ptr = vs_ptr->SelectRs(cli_tp);
+  // No rs attached to vs
+  if (unlikely(!rs_ptr)) return nullptr;
+
+  Tuple2 loc_tp;
+  // Local tuple runs out
+  if (unlikely(!rs_ptr->GetLocal(loc_tp))) return nullptr;
+
+  auto idx = idx_pool_.top();
+
+  // Neither direction exists since the original was just missed, so use
+  // unsafe here for performance
+  IdxMap::Entry *orig_ent = idx_map_.EmplaceUnsafe({cli_tp, vs_ptr->tuple()},
+                                                   idx);
+  // Collision exceeded
+  if (unlikely(orig_ent == nullptr)) {
+    rs_ptr->PutLocal(loc_tp);
+    return nullptr;
+  }
+
+  IdxMap::Entry *rep_ent = idx_map_.EmplaceUnsafe({rs_ptr->tuple(), loc_tp},
+                                                  idx);
+  // Collision exceeded
+  if (unlikely(rep_ent == nullptr)) {
+    rs_ptr->PutLocal(loc_tp);
+    idx_map_.Remove(orig_ent->key);
+    return nullptr;
+  }
+
+  idx_pool_.pop();
+
+  Flow *flow = &flows_[idx];
+
+  flow->local_ = loc_tp;
+  flow->client_ = cli_tp;
+  flow->virt_ = vs_ptr;
+  flow->real_ = rs_ptr;
+
+  rs_ptr->IncrActiveConns();
+  rs_ptr->IncrConns(1);
+  vs_ptr->IncrActiveConns();
+  vs_ptr->IncrConns(1);
+
+  refresh(flow);
+
+  W_DVLOG(2) << "created Flow: " << *flow;
+
+  return flow;
+}
+
+void FlowTable::Remove(Flow *flow) {
+  W_DVLOG(2) << "removed Flow: " << *flow;
+
+  flow->Cancel();
+  flow->execute(&timer_);
+}
+
+}  // namespace xlb::conntrack
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "conntrack/common.h"
+#include "conntrack/conn.h"
+#include "conntrack/service.h"
+#include "conntrack/tuple.h"
+
+namespace xlb::conntrack {
+
+// A udp flow has no state to track like 'Conn', it lives until it is idle for
+// the timeout
+class alignas(64) Flow : public EventBase<Flow> {
+ public:
+  Flow() = default;
+  ~Flow() = default;
+
+  void execute(TimerWheel<Flow> *timer);
+
+  VirtSvc::Ptr &virt() { return virt_; }
+  RealSvc::Ptr &real() { return real_; }
+  Tuple2 &local() { return local_; }
+  Tuple2 &client() { return client_; }
+
+  // Here you need to ensure that the tuple belongs to this flow
+  ip_conntrack_dir direction(const Tuple4 &tuple) const {
+    return tuple.dst.ip == local_.ip ? IP_CT_DIR_REPLY : IP_CT_DIR_ORIGINAL;
+  }
+
+ private:
+  Tuple2 client_;
+  Tuple2 local_;
+
+  VirtSvc::Ptr virt_;
+  RealSvc::Ptr real_;
+
+  inline uint32_t index() const;
+
+  friend std::ostream &operator<<(std::ostream &os, const Flow &flow);
+
+  friend class FlowTable;
+};
+
+static_assert(sizeof(Flow) == 64);
+
+class FlowTable {
+ public:
+  FlowTable()
+      : flows_(align_ceil_pow2(CONFIG.udp.max_flows), ALLOC),
+        idx_map_(flows_.capacity()),
+        idx_pool_(make_vector<uint32_t>(flows_.capacity())),
+        timeout_(CONFIG.udp.timeout * tsc_ms),
+        timer_(W_TSC) {
+    // Since 0 means trick of empty
+    for (auto idx : irange(1ul, flows_.capacity())) idx_pool_.push(idx);
+    W_LOG(INFO) << "initializing succeed";
+  }
+  ~FlowTable() = default;
+
+  // Return the flow of either direction with its timeout restarted
+  Flow *Find(const Tuple4 &tuple);
+  // Create a flow from the client to the vs, which must not exist. The rs is
+  // selected by the vs unless 'rs_ptr' is given. Return nullptr if there is no
+  // rs or local tuple available.
+  Flow *Get(VirtSvc::Ptr &vs_ptr, const Tuple2 &cli_tp,
+            RealSvc::Ptr rs_ptr = {});
+  // Release a flow before it expires
+  void Remove(Flow *flow);
+
+  size_t Sync() { return timer_.AdvanceTo(W_TSC); }
+
+ private:
+  using IdxMap = XMap<Tuple4, uint32_t>;
+
+  void refresh(Flow *flow) {
+    timer_.ScheduleInRange(flow, timeout_, timeout_ + 100 * tsc_ms);
+  }
+
+  vector<Flow> flows_;
+  IdxMap idx_map_;
+  std::stack<uint32_t, vector<uint32_t>> idx_pool_;
+  uint64_t timeout_;
+
+  TimerWheel<Flow> timer_;
+
+  friend Flow;
+  DISALLOW_COPY_AND_ASSIGN(FlowTable);
+};
+
+}  // namespace xlb::conntrack
+
+namespace xlb {
+
+#define UTABLE_INIT (UnsafeSingletonTLS<conntrack::FlowTable>::Init)
+#define UTABLE (UnsafeSingletonTLS<conntrack::FlowTable>::instance())
+
+}  // namespace xlb
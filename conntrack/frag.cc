@@ -0,0 +1,73 @@
+#include "conntrack/frag.h"
+
+namespace xlb::conntrack {
+
+uint32_t Datagram::index() const { return (this - &FTABLE.dgrams_[0]); }
+
+void Datagram::execute(TimerWheel<Datagram> *timer) {
+  W_DVLOG(3) << "[Datagram] expired: " << key_
+             << " held: " << unsigned{held_cnt_};
+
+  FTABLE.release(this);
+}
+
+Datagram *FragTable::Get(const FragKey &key) {
+  IdxMap::Entry *entry = idx_map_.Find(key);
+
+  if (likely(entry != nullptr)) return &dgrams_[entry->value];
+
+  if (unlikely(idx_pool_.empty())) return nullptr;
+
+  auto idx = idx_pool_.top();
+
+  // Collision exceeded
+  if (unlikely(idx_map_.Emplace(key, idx) == nullptr)) return nullptr;
+
+  idx_pool_.pop();
+
+  auto *dgram = &dgrams_[idx];
+  dgram->key_ = key;
+  dgram->learned_ = false;
+  dgram->held_cnt_ = 0;
+
+  // Not refreshed by later fragments, just like the timeout of reassembly
+  auto timeout = CONFIG.frag.timeout * tsc_ms;
+  timer_.ScheduleInRange(dgram, timeout, timeout + 100 * tsc_ms);
+
+  return dgram;
+}
+
+bool FragTable::Hold(Datagram *dgram, Packet *packet) {
+  if (unlikely(dgram->held_cnt_ == Datagram::kMaxHeld ||
+               held_cnt_ == CONFIG.frag.max_held))
+    return false;
+
+  dgram->held_[dgram->held_cnt_++] = packet;
+  held_cnt_++;
+
+  return true;
+}
+
+void FragTable::Learn(Datagram *dgram, be16_t src_port, be16_t dst_port,
+                      PacketBatch *batch) {
+  dgram->learned_ = true;
+  dgram->src_port_ = src_port;
+  dgram->dst_port_ = dst_port;
+
+  batch->Push(dgram->held_, dgram->held_cnt_);
+  held_cnt_ -= dgram->held_cnt_;
+  dgram->held_cnt_ = 0;
+}
+
+void FragTable::release(Datagram *dgram) {
+  dgram->Cancel();
+  idx_map_.Remove(dgram->key_);
+  idx_pool_.push(dgram->index());
+
+  // The first fragment never arrived
+  Packet::Free(dgram->held_, dgram->held_cnt_);
+  held_cnt_ -= dgram->held_cnt_;
+  dgram->held_cnt_ = 0;
+}
+
+}  // namespace xlb::conntrack
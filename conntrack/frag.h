@@ -0,0 +1,146 @@
+#pragma once
+
+#include "runtime/packet_batch.h"
+
+#include "conntrack/common.h"
+
+namespace xlb::conntrack {
+
+// Identifies the fragments of an ipv4 datagram
+struct [[gnu::packed]] FragKey {
+  FragKey(const be32_t &_src, const be32_t &_dst, const be16_t &_id,
+          uint8_t _proto)
+      : src(_src), dst(_dst), id(_id), proto(_proto) {}
+
+  FragKey() = default;
+  ~FragKey() = default;
+
+  be32_t src;
+  be32_t dst;
+  be16_t id;
+  uint8_t proto;
+
+  friend std::ostream &operator<<(std::ostream &os, const FragKey &key) {
+    os << "[src: " << ToIpv4Address(key.src)
+       << " dst: " << ToIpv4Address(key.dst) << " id: " << key.id.value()
+       << " proto: " << unsigned{key.proto} << "]";
+    return os;
+  }
+};
+
+static_assert(sizeof(FragKey) == 11);
+
+}  // namespace xlb::conntrack
+
+namespace std {
+
+template <>
+struct hash<xlb::conntrack::FragKey> {
+  size_t operator()(const xlb::conntrack::FragKey &key) const {
+    auto addrs = hash_combine(hash<xlb::be32_t>{}(key.src),
+                              hash<xlb::be32_t>{}(key.dst));
+    uint32_t id_proto = uint32_t{key.id.raw_value()} << 8 | key.proto;
+    return hash_combine(addrs, hash<uint32_t>{}(id_proto));
+  }
+};
+
+template <>
+struct equal_to<xlb::conntrack::FragKey> {
+  bool operator()(const xlb::conntrack::FragKey &lhs,
+                  const xlb::conntrack::FragKey &rhs) const {
+    return lhs.src == rhs.src && lhs.dst == rhs.dst && lhs.id == rhs.id &&
+           lhs.proto == rhs.proto;
+  }
+};
+
+}  // namespace std
+
+namespace xlb::conntrack {
+
+// Remembers the l4 ports carried by the first fragment of a datagram, so that
+// the rest of fragments can follow the same connection without reassembly
+class alignas(64) Datagram : public EventBase<Datagram> {
+ public:
+  // Fragments arriving before the first one
+  static constexpr size_t kMaxHeld = 4;
+
+  Datagram() = default;
+  ~Datagram() = default;
+
+  void execute(TimerWheel<Datagram> *timer);
+
+  bool learned() const { return learned_; }
+  be16_t src_port() const { return src_port_; }
+  be16_t dst_port() const { return dst_port_; }
+
+ private:
+  FragKey key_;
+  bool learned_;
+  uint8_t held_cnt_;
+  be16_t src_port_;
+  be16_t dst_port_;
+
+  Packet *held_[kMaxHeld];
+
+  inline uint32_t index() const;
+
+  friend class FragTable;
+};
+
+static_assert(sizeof(Datagram) == 128);
+
+class FragTable {
+ public:
+  FragTable()
+      : dgrams_(align_ceil_pow2(CONFIG.frag.max_datagrams), ALLOC),
+        idx_map_(dgrams_.capacity()),
+        idx_pool_(make_vector<uint32_t>(dgrams_.capacity())),
+        held_cnt_(0),
+        timer_(W_TSC) {
+    // Since 0 means trick of empty
+    for (auto idx : irange(1ul, dgrams_.capacity())) idx_pool_.push(idx);
+    W_LOG(INFO) << "initializing succeed";
+  }
+  ~FragTable() = default;
+
+  // Return the datagram that the fragment belongs to, a new one is tracked
+  // until the timeout if not found. Return nullptr if the table is full, so a
+  // flood of fragments can not exhaust it.
+  Datagram *Get(const FragKey &key);
+
+  // Hold a fragment until the first one arrives, return false if either the
+  // datagram or the slave holds too many
+  bool Hold(Datagram *dgram, Packet *packet);
+
+  // Remember the ports of the first fragment, and move the fragments held
+  // before it to 'batch'
+  void Learn(Datagram *dgram, be16_t src_port, be16_t dst_port,
+             PacketBatch *batch);
+
+  size_t Sync() { return timer_.AdvanceTo(W_TSC); }
+
+ private:
+  using IdxMap = XMap<FragKey, uint32_t>;
+
+  void release(Datagram *dgram);
+
+  vector<Datagram> dgrams_;
+  IdxMap idx_map_;
+  std::stack<uint32_t, vector<uint32_t>> idx_pool_;
+  // Fragments held by all datagrams
+  size_t held_cnt_;
+
+  TimerWheel<Datagram> timer_;
+
+  friend Datagram;
+  DISALLOW_COPY_AND_ASSIGN(FragTable);
+};
+
+}  // namespace xlb::conntrack
+
+namespace xlb {
+
+#define FTABLE_INIT (UnsafeSingletonTLS<conntrack::FragTable>::Init)
+#define FTABLE (UnsafeSingletonTLS<conntrack::FragTable>::instance())
+
+}  // namespace xlb
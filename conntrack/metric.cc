@@ -14,12 +14,36 @@ std::string combine_prefix(std::string_view type) {
   return Format("xlb_service_%s", std::string(type).c_str());
 }
 
-std::string combine_svc_metric_name(const Tuple2 &tuple,
+template <typename Addr>
+std::string combine_svc_metric_name(const BasicTuple2<Addr> &tuple,
                                     std::string_view name) {
-  return Format("%s_%d_%s", headers::ToIpv4Address(tuple.ip).c_str(),
+  return Format("%s_%d_%s", ToIpAddress(tuple.ip).c_str(),
                 tuple.port.value(), std::string(name).c_str());
 }
 
+template <size_t N>
+uint64_t rtt_percentile(const std::array<uint64_t, N> &hist, uint64_t total,
+                        uint64_t percent) {
+  uint64_t target = (total * percent + 99) / 100;
+  uint64_t before = 0;
+
+  for (auto i : irange(N)) {
+    if (before + hist[i] < target) {
+      before += hist[i];
+      continue;
+    }
+
+    // Bucket 'i' covers [2^(i-1), 2^i), interpolate linearly inside it
+    uint64_t lo = i == 0 ? 0 : 1ul << (i - 1);
+    uint64_t hi = i == N - 1 ? 1ul << 16 : 1ul << i;
+
+    return (lo + (hi - lo) * (target - before) / hist[i]) *
+           SvcMetrics::kRttUnit;
+  }
+
+  return 0;
+}
+
 }  // namespace
 
 bool Metric::Expose(std::string_view prefix, std::string_view name) {
@@ -34,7 +58,9 @@ void Metric::Hide() {
   count_.hide();
 }
 
-bool SvcMetrics::Expose(std::string_view type, const Tuple2 &tuple) {
+template <typename Addr>
+bool SvcMetrics::Expose(std::string_view type,
+                        const BasicTuple2<Addr> &tuple) {
   if (conns_.Expose(combine_prefix(type),
                     combine_svc_metric_name(tuple, "conns")) &&
       packets_in_.Expose(combine_prefix(type),
@@ -44,7 +70,15 @@ bool SvcMetrics::Expose(std::string_view type, const Tuple2 &tuple) {
       packets_out_.Expose(combine_prefix(type),
                           combine_svc_metric_name(tuple, "packets_out")) &&
       bytes_out_.Expose(combine_prefix(type),
-                        combine_svc_metric_name(tuple, "bytes_out"))) {
+                        combine_svc_metric_name(tuple, "bytes_out")) &&
+      handshakes_.Expose(combine_prefix(type),
+                         combine_svc_metric_name(tuple, "handshakes")) &&
+      failures_.Expose(combine_prefix(type),
+                       combine_svc_metric_name(tuple, "failures")) &&
+      rtt_p50_.expose_as(combine_prefix(type),
+                         combine_svc_metric_name(tuple, "rtt_p50")) == 0 &&
+      rtt_p99_.expose_as(combine_prefix(type),
+                         combine_svc_metric_name(tuple, "rtt_p99")) == 0) {
     W_DVLOG(1) << "exposed metrics type: " << type << " service: " << tuple;
     return true;
   } else {
@@ -55,6 +89,10 @@ bool SvcMetrics::Expose(std::string_view type, const Tuple2 &tuple) {
   }
 }
 
+template bool SvcMetrics::Expose(std::string_view type, const Tuple2 &tuple);
+template bool SvcMetrics::Expose(std::string_view type,
+                                 const Ipv6Tuple2 &tuple);
+
 void SvcMetrics::Hide() {
   if (!hidden_.test_and_set()) {
     conns_.Hide();
@@ -62,7 +100,27 @@ void SvcMetrics::Hide() {
     bytes_in_.Hide();
     packets_out_.Hide();
     bytes_out_.Hide();
+    handshakes_.Hide();
+    failures_.Hide();
+    rtt_p50_.hide();
+    rtt_p99_.hide();
   }
 }
 
+void SvcMetrics::UpdateRtt() {
+  std::array<uint64_t, kRttBuckets> hist;
+  uint64_t total = 0;
+
+  for (auto i : irange(kRttBuckets)) {
+    hist[i] = rtt_hist_[i].exchange(0, std::memory_order_relaxed);
+    total += hist[i];
+  }
+
+  // Keep the last percentiles if there is no handshake
+  if (total == 0) return;
+
+  rtt_p50_.set_value(rtt_percentile(hist, total, 50));
+  rtt_p99_.set_value(rtt_percentile(hist, total, 99));
+}
+
 }  // namespace xlb::conntrack
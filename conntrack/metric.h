@@ -5,6 +5,13 @@
 
 namespace xlb::conntrack {
 
+template <typename Addr>
+class BasicSvcBase;
+template <typename Addr>
+class BasicRealSvc;
+template <typename Addr>
+class BasicSvcTable;
+
 class Metric {
  public:
   ~Metric() = default;
@@ -19,7 +26,10 @@ class Metric {
   bvar::PerSecond<bvar::Adder<uint64_t>> per_second_;
 
   friend class SvcMetrics;
-  friend class SvcBase;
+  template <typename Addr>
+  friend class BasicSvcBase;
+  template <typename Addr>
+  friend class BasicRealSvc;
 };
 
 class SvcMetrics : public intrusive_ref_counter<SvcMetrics>, public INew {
@@ -29,13 +39,22 @@ class SvcMetrics : public intrusive_ref_counter<SvcMetrics>, public INew {
   ~SvcMetrics() = default;
 
   // 'Expose' is not thread safe, but 'Hide' is different
-  bool Expose(std::string_view type, const Tuple2 &tuple);
+  template <typename Addr>
+  bool Expose(std::string_view type, const BasicTuple2<Addr> &tuple);
   void Hide();
 
   static Ptr Get() { return {new SvcMetrics()}; }
 
+  // Histogram of handshake rtt in log2 buckets of 'kRttUnit' microseconds
+  static constexpr size_t kRttBuckets = 16;
+  static constexpr uint64_t kRttUnit = 32;
+
+  // This should only be called in the trivial, calculate percentiles of rtt
+  // committed since the last call
+  void UpdateRtt();
+
  protected:
-  SvcMetrics() = default;
+  SvcMetrics() : active_conns_(0), rtt_hist_() {}
 
  private:
   std::atomic_flag hidden_ = ATOMIC_FLAG_INIT;
@@ -45,9 +64,25 @@ class SvcMetrics : public intrusive_ref_counter<SvcMetrics>, public INew {
   Metric bytes_in_;
   Metric packets_out_;
   Metric bytes_out_;
+  // Handshakes answered or failed by real service
+  Metric handshakes_;
+  Metric failures_;
+
+  // Sum of active connections committed by slaves
+  std::atomic<int64_t> active_conns_;
+
+  std::array<std::atomic<uint64_t>, kRttBuckets> rtt_hist_;
+  // In microseconds
+  bvar::Status<uint64_t> rtt_p50_;
+  bvar::Status<uint64_t> rtt_p99_;
 
   friend class SvcMetricsPool;
-  friend class SvcBase;
+  template <typename Addr>
+  friend class BasicSvcBase;
+  template <typename Addr>
+  friend class BasicRealSvc;
+  template <typename Addr>
+  friend class BasicSvcTable;
 };
 
 }  // namespace xlb::conntrack
@@ -0,0 +1,80 @@
+#include "conntrack/persist.h"
+
+namespace xlb::conntrack {
+
+uint32_t Session::index() const { return (this - &PTABLE.sessions_[0]); }
+
+void Session::execute(TimerWheel<Session> *timer) {
+  W_DVLOG(3) << "[Session] expired: " << key_;
+
+  PTABLE.release(this);
+}
+
+RealSvc::Ptr PersistTable::Select(VirtSvc::Ptr &vs_ptr, const Tuple2 &cli_tp) {
+  PersistKey key{vs_ptr->tuple(), cli_tp.ip};
+  IdxMap::Entry *entry = idx_map_.Find(key);
+
+  auto timeout = vs_ptr->persist_timeout() * tsc_sec;
+
+  if (entry != nullptr) {
+    auto *session = &sessions_[entry->value];
+    auto &rs = session->real_;
+
+    if (session->version_ != vs_ptr->version() && vs_ptr->Attached(rs))
+      session->version_ = vs_ptr->version();
+
+    if (likely(session->version_ == vs_ptr->version() && !rs->ejected() &&
+               !rs->saturated())) {
+      timer_.ScheduleInRange(session, timeout, timeout + tsc_sec);
+      return rs;
+    }
+
+    // Not usable anymore, select again with the session reused
+    W_DVLOG(3) << "[Session] reselecting: " << key;
+    release(session);
+  }
+
+  // Connections from the same client select the same rs as long as possible
+  auto rs_ptr = vs_ptr->SelectRs({cli_tp.ip, be16_t(0)});
+  if (unlikely(!rs_ptr)) return rs_ptr;
+
+  if (unlikely(idx_pool_.empty())) evict();
+
+  auto idx = idx_pool_.top();
+  idx_pool_.pop();
+
+  entry = idx_map_.Emplace(key, idx);
+  // Collision exceeded, the connection just does not stick
+  if (unlikely(entry == nullptr)) {
+    idx_pool_.push(idx);
+    return rs_ptr;
+  }
+
+  auto *session = &sessions_[idx];
+  session->key_ = key;
+  session->version_ = vs_ptr->version();
+  session->real_ = rs_ptr;
+
+  timer_.ScheduleInRange(session, timeout, timeout + tsc_sec);
+
+  return rs_ptr;
+}
+
+void PersistTable::evict() {
+  auto *session = &sessions_[hand_];
+
+  if (++hand_ == sessions_.size()) hand_ = 1;
+
+  W_DVLOG(3) << "[Session] evicting: " << session->key_;
+
+  release(session);
+}
+
+void PersistTable::release(Session *session) {
+  session->Cancel();
+  idx_map_.Remove(session->key_);
+  idx_pool_.push(session->index());
+  session->real_.reset();
+}
+
+}  // namespace xlb::conntrack
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "conntrack/common.h"
+#include "conntrack/service.h"
+#include "conntrack/tuple.h"
+
+namespace xlb::conntrack {
+
+struct [[gnu::packed]] PersistKey {
+  PersistKey(const Tuple2 &_virt, const be32_t &_client)
+      : virt(_virt), client(_client) {}
+
+  PersistKey() = default;
+  ~PersistKey() = default;
+
+  Tuple2 virt;
+  be32_t client;
+
+  friend std::ostream &operator<<(std::ostream &os, const PersistKey &key) {
+    os << "[virt: " << key.virt
+       << " client: " << headers::ToIpv4Address(key.client) << "]";
+    return os;
+  }
+};
+
+static_assert(sizeof(PersistKey) == 10);
+
+}  // namespace xlb::conntrack
+
+namespace std {
+
+template <>
+struct hash<xlb::conntrack::PersistKey> {
+  size_t operator()(const xlb::conntrack::PersistKey &key) const {
+    return hash_combine(hash<xlb::conntrack::Tuple2>{}(key.virt),
+                        hash<xlb::be32_t>{}(key.client));
+  }
+};
+
+template <>
+struct equal_to<xlb::conntrack::PersistKey> {
+  bool operator()(const xlb::conntrack::PersistKey &lhs,
+                  const xlb::conntrack::PersistKey &rhs) const {
+    return equal_to<xlb::conntrack::Tuple2>{}(lhs.virt, rhs.virt) &&
+           lhs.client == rhs.client;
+  }
+};
+
+}  // namespace std
+
+namespace xlb::conntrack {
+
+// Sticks a client ip to the rs of a vs until it is idle for the persistence
+// timeout of the vs
+class alignas(64) Session : public EventBase<Session> {
+ public:
+  Session() = default;
+  ~Session() = default;
+
+  void execute(TimerWheel<Session> *timer);
+
+ private:
+  PersistKey key_;
+  // Version of the vs when 'real_' was known to be attached
+  uint32_t version_;
+
+  RealSvc::Ptr real_;
+
+  inline uint32_t index() const;
+
+  friend class PersistTable;
+};
+
+static_assert(sizeof(Session) == 64);
+
+class PersistTable {
+ public:
+  PersistTable()
+      : sessions_(align_ceil_pow2(CONFIG.svc.max_persistence), ALLOC),
+        idx_map_(sessions_.capacity()),
+        idx_pool_(make_vector<uint32_t>(sessions_.capacity())),
+        hand_(1),
+        timer_(W_TSC) {
+    // Since 0 means trick of empty
+    for (auto idx : irange(1ul, sessions_.capacity())) idx_pool_.push(idx);
+    W_LOG(INFO) << "initializing succeed";
+  }
+  ~PersistTable() = default;
+
+  // Return the rs that the client sticks to, select and stick to a new one if
+  // there is no usable one
+  RealSvc::Ptr Select(VirtSvc::Ptr &vs_ptr, const Tuple2 &cli_tp);
+
+  size_t Sync() { return timer_.AdvanceTo(W_TSC); }
+
+ private:
+  using IdxMap = XMap<PersistKey, uint32_t>;
+
+  // Release the session that the clock hand points to when it is full, so a
+  // flood of source ip can not exhaust the table
+  void evict();
+  void release(Session *session);
+
+  vector<Session> sessions_;
+  IdxMap idx_map_;
+  std::stack<uint32_t, vector<uint32_t>> idx_pool_;
+  uint32_t hand_;
+
+  TimerWheel<Session> timer_;
+
+  friend Session;
+  DISALLOW_COPY_AND_ASSIGN(PersistTable);
+};
+
+}  // namespace xlb::conntrack
+
+namespace xlb {
+
+#define PTABLE_INIT (UnsafeSingletonTLS<conntrack::PersistTable>::Init)
+#define PTABLE (UnsafeSingletonTLS<conntrack::PersistTable>::instance())
+
+}  // namespace xlb
@@ -1,46 +1,218 @@
 #include "conntrack/service.h"
+
+#include <cmath>
+
 #include "conntrack/table.h"
 
 namespace xlb::conntrack {
 
-SvcBase::SvcBase(const Tuple2 &tuple) : tuple_(tuple), metrics_(nullptr) {
+template <typename Addr>
+BasicSvcBase<Addr>::BasicSvcBase(const Tuple2 &tuple, Type type)
+    : tuple_(tuple),
+      type_(type),
+      metrics_(nullptr),
+      srtt_(0),
+      active_conns_(0),
+      committed_active_(0) {
   reset_metrics();
-  STABLE.timer_.ScheduleInRange(this, kTimerStart * tsc_ms, kTimerEnd * tsc_ms);
+  STABLE_OF(Addr).timer_.ScheduleInRange(this, kTimerStart * tsc_ms,
+                                         kTimerEnd * tsc_ms);
 }
 
-void SvcBase::commit_metrics() {
+template <typename Addr>
+void BasicSvcBase<Addr>::commit_metrics() {
   metrics_->conns_.count_ << conns_;
   metrics_->packets_in_.count_ << packets_in_;
   metrics_->bytes_in_.count_ << bytes_in_;
   metrics_->packets_out_.count_ << packets_out_;
   metrics_->bytes_out_.count_ << bytes_out_;
+  metrics_->handshakes_.count_ << handshakes_;
+  metrics_->failures_.count_ << failures_;
+
+  if (active_conns_ != committed_active_) {
+    metrics_->active_conns_.fetch_add(
+        int64_t(active_conns_) - committed_active_, std::memory_order_relaxed);
+    committed_active_ = active_conns_;
+  }
+
+  for (auto i : irange(SvcMetrics::kRttBuckets))
+    if (rtt_hist_[i] != 0)
+      metrics_->rtt_hist_[i].fetch_add(rtt_hist_[i], std::memory_order_relaxed);
+
   reset_metrics();
 }
 
-void SvcBase::reset_metrics() {
+template <typename Addr>
+void BasicSvcBase<Addr>::reset_metrics() {
   conns_ = 0;
   packets_in_ = 0;
   bytes_in_ = 0;
   packets_out_ = 0;
   bytes_out_ = 0;
+  handshakes_ = 0;
+  failures_ = 0;
+  rtt_hist_.fill(0);
+}
+
+template <typename Addr>
+void BasicSvcBase<Addr>::RecordRtt(uint16_t rtt) {
+  // Bucket 'i' covers [2^(i-1), 2^i)
+  size_t bucket = rtt == 0 ? 0 : 32 - __builtin_clz(rtt);
+  ++rtt_hist_[std::min(bucket, SvcMetrics::kRttBuckets - 1)];
+
+  if (unlikely(srtt_ == 0))
+    srtt_ = rtt << 3;
+  else
+    srtt_ += rtt - (srtt_ >> 3);
 }
 
-void SvcBase::execute(TimerWheel<SvcBase> *timer) {
+template <typename Addr>
+void BasicSvcBase<Addr>::execute(TimerWheel<BasicSvcBase> *timer) {
   W_DVLOG(4) << "commit metrics of: " << tuple_;
 
   commit_metrics();
-  STABLE.timer_.ScheduleInRange(this, kTimerStart * tsc_ms, kTimerEnd * tsc_ms);
+  if (type_ == kVirt)
+    static_cast<BasicVirtSvc<Addr> *>(this)->RefreshWeights();
+
+  STABLE_OF(Addr).timer_.ScheduleInRange(this, kTimerStart * tsc_ms,
+                                         kTimerEnd * tsc_ms);
+}
+
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicVirtSvc<Addr>::SelectRs(
+    const Tuple2 &ctuple) {
+  auto rs = select(ctuple);
+  if (rs || !has_overflow_) return rs;
+
+  // The overflow of the overflow vs is not followed
+  auto vs = STABLE_OF(Addr).FindVs(overflow_, protocol_);
+  return vs ? vs->select(ctuple) : typename RealSvc::Ptr();
 }
 
-RealSvc::Ptr VirtSvc::SelectRs(const Tuple2 &ctuple) {
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicVirtSvc<Addr>::select(
+    const Tuple2 &ctuple) {
   if (unlikely(rs_vec_.empty())) return {};
 
-  // TODO: abstract selector
+  switch (selector_) {
+    case Selector::kLatency:
+      return select_by_latency(ctuple);
+    default:
+      return select_by_hash(ctuple);
+  }
+}
+
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicVirtSvc<Addr>::select_by_hash(
+    const Tuple2 &ctuple) {
+  auto size = rs_vec_.size();
+  auto idx = find_member(std::hash<Tuple2>()(ctuple) % bounds_.back());
+
+  for (auto i : irange(size)) {
+    auto &rs = rs_vec_[(idx + i) % size].rs;
+    if (likely(!rs->ejected() && !rs->saturated())) return rs;
+  }
+
+  // Better than nothing when all of them are ejected, but saturated rs must
+  // not be selected
+  auto &rs = rs_vec_[idx].rs;
+  return rs->saturated() ? typename RealSvc::Ptr() : rs;
+}
+
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicVirtSvc<Addr>::select_by_latency(
+    const Tuple2 &ctuple) {
+  auto *random = W_CURRENT->random();
+
+  auto &first = rs_vec_[find_member(random->Real() * bounds_.back())].rs;
+  auto &second = rs_vec_[find_member(random->Real() * bounds_.back())].rs;
+
+  bool first_ok = !first->ejected() && !first->saturated();
+  bool second_ok = !second->ejected() && !second->saturated();
+
+  if (unlikely(!first_ok))
+    return second_ok ? second : select_by_hash(ctuple);
+  if (unlikely(!second_ok)) return first;
+
+  // Rs without any sample has 0 srtt, which makes it warm up quickly
+  return first->srtt() <= second->srtt() ? first : second;
+}
+
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicVirtSvc<Addr>::FindRs(
+    uint64_t server_id) const {
+  auto it = std::lower_bound(servers_.begin(), servers_.end(),
+                             std::make_pair(server_id, (RealSvc *)nullptr));
+
+  if (it != servers_.end() && it->first == server_id) return {it->second};
+
+  return {};
+}
+
+template <typename Addr>
+bool BasicVirtSvc<Addr>::Attached(const typename RealSvc::Ptr &rs) const {
+  return std::any_of(rs_vec_.begin(), rs_vec_.end(),
+                     [&rs](auto &member) { return member.rs == rs; });
+}
+
+template <typename Addr>
+void BasicVirtSvc<Addr>::RefreshWeights() {
+  auto from = rs_vec_.size();
+
+  for (auto i : irange(rs_vec_.size())) {
+    auto &member = rs_vec_[i];
+    if (member.effective == uint64_t(member.weight) << kWeightShift) continue;
+
+    member.effective = ramp_weight(member);
+    from = std::min(from, i);
+  }
 
-  return rs_vec_[std::hash<Tuple2>()(ctuple) % rs_vec_.size()];
+  rebuild_bounds(from);
 }
 
-bool RealSvc::GetLocal(Tuple2 &tuple) {
+template <typename Addr>
+uint64_t BasicVirtSvc<Addr>::ramp_weight(const Member &member) const {
+  uint64_t full = uint64_t(member.weight) << kWeightShift;
+
+  if (slow_start_ == 0) return full;
+
+  double progress = double(W_TSC - member.since) / (slow_start_ * tsc_sec);
+  if (progress >= 1) return full;
+
+  double factor = ramp_ == Ramp::kLinear
+                      ? progress
+                      : std::exp2((progress - 1) * kWeightShift);
+
+  return std::max<uint64_t>(full * factor, 1);
+}
+
+template <typename Addr>
+void BasicVirtSvc<Addr>::rebuild_bounds(size_t from) {
+  bounds_.resize(rs_vec_.size());
+
+  for (auto i : irange(from, rs_vec_.size()))
+    bounds_[i] = (i == 0 ? 0 : bounds_[i - 1]) + rs_vec_[i].effective;
+}
+
+template <typename Addr>
+void BasicVirtSvc<Addr>::rebuild_servers() {
+  servers_.clear();
+
+  for (auto &member : rs_vec_)
+    if (member.server_id != 0)
+      servers_.emplace_back(member.server_id, member.rs.get());
+
+  std::sort(servers_.begin(), servers_.end());
+}
+
+template <typename Addr>
+size_t BasicVirtSvc<Addr>::find_member(uint64_t point) const {
+  return std::upper_bound(bounds_.begin(), bounds_.end(), point) -
+         bounds_.begin();
+}
+
+template <typename Addr>
+bool BasicRealSvc<Addr>::GetLocal(Tuple2 &tuple) {
   if (local_tuple_pool_.empty()) return false;
 
   tuple = local_tuple_pool_.top();
@@ -49,12 +221,73 @@ bool RealSvc::GetLocal(Tuple2 &tuple) {
   return true;
 }
 
-void RealSvc::PutLocal(const Tuple2 &tuple) { local_tuple_pool_.push(tuple); }
+template <typename Addr>
+void BasicRealSvc<Addr>::PutLocal(const Tuple2 &tuple) {
+  local_tuple_pool_.push(tuple);
+}
 
-RealSvc::~RealSvc() {
+template <typename Addr>
+bool BasicRealSvc<Addr>::DetectOutlier() {
+  DCHECK_NOTNULL(metrics_);
+
+  auto &conf = CONFIG.outlier;
+
+  // Merged from all slaves by bvar
+  uint64_t handshakes = metrics_->handshakes_.count_.get_value();
+  uint64_t failures = metrics_->failures_.count_.get_value();
+
+  // The counters restart if the metrics are reset or reused by a re-added rs,
+  // count from zero then instead of wrapping around
+  uint64_t failed =
+      failures < last_failures_ ? failures : failures - last_failures_;
+  uint64_t total = (handshakes < last_handshakes_
+                        ? handshakes
+                        : handshakes - last_handshakes_) +
+                   failed;
+
+  last_handshakes_ = handshakes;
+  last_failures_ = failures;
+
+  if (ejected_) {
+    if (W_TSC < ejected_until_) return false;
+
+    W_LOG(INFO) << "restoring RealSvc: " << tuple_
+                << " ejections: " << ejections_;
+    ejected_ = false;
+    return true;
+  }
+
+  if (total < conf.min_handshakes) return false;
+
+  if (failed <= total * conf.failure_ratio) {
+    if (ejections_ > 0) --ejections_;
+    return false;
+  }
+
+  auto time =
+      std::min(conf.base_ejection_time << ejections_, conf.max_ejection_time);
+
+  W_LOG(WARNING) << "ejecting RealSvc: " << tuple_ << " failed: " << failed
+                 << " total: " << total << " for " << time << " ms";
+
+  ejections_ = std::min(ejections_ + 1, kMaxEjections);
+  ejected_until_ = W_TSC + time * tsc_ms;
+  ejected_ = true;
+  return true;
+}
+
+template <typename Addr>
+BasicRealSvc<Addr>::~BasicRealSvc() {
   W_DVLOG(1) << "lazy destroying: " << tuple_;
   // Means that it cannot be reused
-  STABLE.rs_map_.erase(tuple_);
+  STABLE_OF(Addr).rs_map_.erase(tuple_);
 }
 
+template class BasicSvcBase<be32_t>;
+template class BasicRealSvc<be32_t>;
+template class BasicVirtSvc<be32_t>;
+template class BasicSvcBase<Ipv6::Address>;
+template class BasicRealSvc<Ipv6::Address>;
+template class BasicVirtSvc<Ipv6::Address>;
+
 }  // namespace xlb::conntrack
@@ -6,15 +6,61 @@
 
 namespace xlb::conntrack {
 
-class SvcBase : public EventBase<SvcBase>, public INew {
+// How 'VirtSvc' selects 'RealSvc' for new connections
+enum class Selector : uint8_t {
+  kHash,
+  // Power of two choices on the smoothed handshake rtt
+  kLatency,
+};
+
+// How the weight of newly attached 'RealSvc' ramps up in slow start
+enum class Ramp : uint8_t {
+  kLinear,
+  kExponential,
+};
+
+// Transport protocol of 'VirtSvc', services of tcp and udp with the same tuple
+// are different ones
+enum class Protocol : uint8_t {
+  kTcp,
+  kUdp,
+};
+
+// How 'VirtSvc' forwards packets to 'RealSvc'
+enum class Forward : uint8_t {
+  kFullNat,
+  // Direct server return, only the destination mac is rewritten and replies
+  // do not come back
+  kDr,
+  // Encapsulated toward rs and replies do not come back either
+  kIpip,
+  kGue,
+};
+
+template <typename Addr>
+class BasicVirtSvc;
+template <typename Addr>
+class BasicSvcTable;
+
+// Services of ipv4 and ipv6 are kept apart by the address type 'Addr', which
+// is either 'be32_t' or 'Ipv6::Address'
+template <typename Addr>
+class BasicSvcBase : public EventBase<BasicSvcBase<Addr>>, public INew {
  public:
-  explicit SvcBase(const Tuple2 &tuple);
+  using Tuple2 = BasicTuple2<Addr>;
+
+  enum Type : uint8_t { kReal, kVirt };
+
+  BasicSvcBase(const Tuple2 &tuple, Type type);
   // WARNING: This is not a virtual function (optimized for size)
-  ~SvcBase() {
+  ~BasicSvcBase() {
     // It is impossible for 'Conn' to have a reference to 'RealSvc/VirtSvc' in
     // master, so the first call of 'Hide' must be in the master, since the call
     // to 'Hide' is atomic, and then the call in the slave will return directly
     metrics_->Hide();
+    // There must be no connection referencing it now
+    metrics_->active_conns_.fetch_sub(committed_active_,
+                                      std::memory_order_relaxed);
   }
 
   auto &tuple() const { return tuple_; }
@@ -24,8 +70,17 @@ class SvcBase : public EventBase<SvcBase>, public INew {
   void IncrBytesIn(uint64_t n) { bytes_in_ += n; }
   void IncrPacketsOut(uint64_t n) { packets_out_ += n; }
   void IncrBytesOut(uint64_t n) { bytes_out_ += n; }
+  void IncrHandshakes(uint64_t n) { handshakes_ += n; }
+  void IncrFailures(uint64_t n) { failures_ += n; }
+  // In units of 'SvcMetrics::kRttUnit' microseconds
+  void RecordRtt(uint16_t rtt);
+  uint32_t srtt() const { return srtt_ >> 3; }
+
+  void IncrActiveConns() { ++active_conns_; }
+  void DecrActiveConns() { --active_conns_; }
+  uint32_t active_conns() const { return active_conns_; }
 
-  void execute(TimerWheel<SvcBase> *timer);
+  void execute(TimerWheel<BasicSvcBase> *timer);
   auto &metrics() { return metrics_; }
   void set_metrics(const SvcMetrics::Ptr &metric) { metrics_ = metric; }
 
@@ -37,6 +92,7 @@ class SvcBase : public EventBase<SvcBase>, public INew {
   inline void commit_metrics();
 
   Tuple2 tuple_;
+  Type type_;
   SvcMetrics::Ptr metrics_;
   //  class SvcTable *stable_;
 
@@ -46,30 +102,82 @@ class SvcBase : public EventBase<SvcBase>, public INew {
   uint64_t bytes_in_;
   uint64_t packets_out_;
   uint64_t bytes_out_;
+  uint64_t handshakes_;
+  uint64_t failures_;
+
+  std::array<uint32_t, SvcMetrics::kRttBuckets> rtt_hist_;
+  // Scaled by 8 like linux, not reset by commit
+  uint32_t srtt_;
 
-  friend class SvcTable;
+  // Active connections in this worker and the part committed to metrics
+  uint32_t active_conns_;
+  uint32_t committed_active_;
 
-  DISALLOW_IMPLICIT_CONSTRUCTORS(SvcBase);
+  friend class BasicSvcTable<Addr>;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(BasicSvcBase);
 };
 
-class alignas(64) RealSvc : public unsafe_intrusive_ref_counter<RealSvc>,
-                            public SvcBase {
+template <typename Addr>
+class alignas(64) BasicRealSvc
+    : public unsafe_intrusive_ref_counter<BasicRealSvc<Addr>>,
+      public BasicSvcBase<Addr> {
  public:
-  using Ptr = intrusive_ptr<RealSvc>;
+  using Tuple2 = BasicTuple2<Addr>;
+  using Ptr = intrusive_ptr<BasicRealSvc>;
+
+  using BasicSvcBase<Addr>::active_conns;
 
   static void InitPrototype() { UnsafeSingletonTLS<prototype>::Init(); }
 
-  ~RealSvc();
+  ~BasicRealSvc();
 
   // Return false if empty
   bool GetLocal(Tuple2 &tuple);
   void PutLocal(const Tuple2 &tuple);
 
+  // Ejected rs will not be selected unless all rs of the vs are ejected
+  bool ejected() const { return ejected_; }
+  void set_ejected(bool ejected) { ejected_ = ejected; }
+
+  // 0 means unlimited, each worker starts with an even share of the limit
+  void set_max_conns(uint32_t max_conns) {
+    max_conns_ = max_conns;
+    quota_ = split_evenly(max_conns, CONFIG.slave_cores.size(), W_ID);
+  }
+  // Allow 'share' more connections in this worker than the active ones
+  void GrantConns(uint32_t share) { quota_ = active_conns() + share; }
+  // Saturated rs will never be selected
+  bool saturated() const {
+    return max_conns_ != 0 && active_conns() >= quota_;
+  }
+
+  // On the local segment of the port and the vlan, only used by vs in DR mode
+  const Ethernet::Address &hw_addr() const { return hw_addr_; }
+  uint16_t port() const { return port_; }
+  uint32_t vlan() const { return vlan_; }
+  void set_hw_addr(const Ethernet::Address &addr, uint16_t port,
+                   uint32_t vlan) {
+    hw_addr_ = addr;
+    port_ = port;
+    vlan_ = vlan;
+  }
+
+  // This should only be called in the trivial, return true if 'ejected'
+  // changes
+  bool DetectOutlier();
+
  private:
   using TPool = std::stack<Tuple2, vector<Tuple2>>;
+
+  using BasicSvcBase<Addr>::tuple_;
+  using BasicSvcBase<Addr>::metrics_;
+
+  static constexpr uint32_t kMaxEjections = 16;
+
   struct prototype {
     prototype() {
-      auto range = CONFIG.slave_local_ips.equal_range(W_ID);
+      auto range = local_ips().equal_range(W_ID);
 
       for (auto it = range.first; it != range.second; ++it) {
         for (auto i :
@@ -81,10 +189,28 @@ class alignas(64) RealSvc : public unsafe_intrusive_ref_counter<RealSvc>,
     TPool local_tuple_pool;
   };
 
-  explicit RealSvc(const Tuple2 &tuple)
-      : SvcBase(tuple),
+  // Local ips of the family for snat
+  static auto &local_ips() {
+    if constexpr (is_ipv4_v<Addr>)
+      return CONFIG.slave_local_ips;
+    else
+      return CONFIG.slave_local_ips6;
+  }
+
+  explicit BasicRealSvc(const Tuple2 &tuple)
+      : BasicSvcBase<Addr>(tuple, BasicSvcBase<Addr>::kReal),
         local_tuple_pool_(
-            UnsafeSingletonTLS<prototype>::instance().local_tuple_pool) {
+            UnsafeSingletonTLS<prototype>::instance().local_tuple_pool),
+        last_handshakes_(0),
+        last_failures_(0),
+        ejected_until_(0),
+        max_conns_(0),
+        quota_(0),
+        ejections_(0),
+        hw_addr_(),
+        port_(0),
+        ejected_(false),
+        vlan_(0) {
     W_DVLOG(1) << "creating: " << tuple;
     //    bind_local_ips();
   }
@@ -93,38 +219,172 @@ class alignas(64) RealSvc : public unsafe_intrusive_ref_counter<RealSvc>,
 
   TPool local_tuple_pool_;
 
-  friend class VirtSvc;
-  friend class SvcTable;
+  // The following are only used in the trivial for outlier detection
+  uint64_t last_handshakes_;
+  uint64_t last_failures_;
+  uint64_t ejected_until_;
 
-  DISALLOW_IMPLICIT_CONSTRUCTORS(RealSvc);
-};
+  uint32_t max_conns_;
+  // Approximate limit of connections in this worker
+  uint32_t quota_;
+
+  // Decays by one in every healthy interval
+  uint32_t ejections_;
 
-static_assert(sizeof(RealSvc) == 128);
+  Ethernet::Address hw_addr_;
+  uint16_t port_;
+  bool ejected_;
+  uint32_t vlan_;
+
+  friend class BasicVirtSvc<Addr>;
+  friend class BasicSvcTable<Addr>;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(BasicRealSvc);
+};
 
-class alignas(64) VirtSvc : public unsafe_intrusive_ref_counter<VirtSvc>,
-                            public SvcBase {
+template <typename Addr>
+class alignas(64) BasicVirtSvc
+    : public unsafe_intrusive_ref_counter<BasicVirtSvc<Addr>>,
+      public BasicSvcBase<Addr> {
  public:
-  using Ptr = intrusive_ptr<VirtSvc>;
-  using RsVec = vector<RealSvc::Ptr>;
+  using Tuple2 = BasicTuple2<Addr>;
+  using RealSvc = BasicRealSvc<Addr>;
+  using Ptr = intrusive_ptr<BasicVirtSvc>;
+
+  struct Member {
+    typename RealSvc::Ptr rs;
+    uint32_t weight;
+    // Ramps up to 'weight << kWeightShift' in slow start
+    uint64_t effective;
+    // When it was attached
+    uint64_t since;
+    // Encoded in the quic connection ids issued by rs, 0 means none
+    uint64_t server_id;
+  };
+  using RsVec = vector<Member>;
+
+  ~BasicVirtSvc() = default;
+
+  typename RealSvc::Ptr SelectRs(const Tuple2 &ctuple);
+  // Return the rs that issued the quic connection id with 'server_id' no
+  // matter if it is ejected or saturated, since the connection lives there
+  typename RealSvc::Ptr FindRs(uint64_t server_id) const;
+
+  Protocol protocol() const { return protocol_; }
+
+  // Packets to the vs are only accepted from its vlan, 0 means untagged. It is
+  // fixed at creation and shared by all vs on the same ip.
+  uint32_t vlan() const { return vlan_; }
+
+  Forward forward() const { return forward_; }
+  void set_forward(Forward forward) { forward_ = forward; }
 
-  ~VirtSvc() = default;
+  // Clamp of the mss option in SYN and SYN-ACK of tcp
+  uint16_t mss() const { return mss_; }
+  void set_mss(uint16_t mss) { mss_ = mss; }
 
-  RealSvc::Ptr SelectRs(const Tuple2 &ctuple);
+  // Bytes of the server id following the first octet of quic connection ids
+  // in plain text (QUIC-LB), 0 means quic is routed like other udp
+  uint8_t quic_server_id_len() const { return quic_server_id_len_; }
+  void set_quic_server_id_len(uint8_t len) { quic_server_id_len_ = len; }
+
+  Selector selector() const { return selector_; }
+  void set_selector(Selector selector) { selector_ = selector; }
+  // In seconds, 0 means disabled
+  void set_slow_start(uint16_t slow_start, Ramp ramp) {
+    slow_start_ = slow_start;
+    ramp_ = ramp;
+  }
+
+  // Connections go to the overflow vs when all rs are saturated
+  void set_overflow(const Tuple2 &overflow) {
+    overflow_ = overflow;
+    has_overflow_ = true;
+  }
+
+  // In seconds, 0 means disabled
+  uint32_t persist_timeout() const { return persist_timeout_; }
+  void set_persist_timeout(uint32_t timeout) { persist_timeout_ = timeout; }
+
+  // Increased whenever any rs is detached
+  uint32_t version() const { return version_; }
+  bool Attached(const typename RealSvc::Ptr &rs) const;
+
+  // Recalculate weights of rs in slow start, called by the timer of 'SvcBase'
+  void RefreshWeights();
 
  private:
-  explicit VirtSvc(const Tuple2 &tuple) : SvcBase(tuple), rs_vec_(ALLOC) {
+  // Weights are scaled to make the ramp smooth
+  static constexpr uint64_t kWeightShift = 10;
+
+  BasicVirtSvc(const Tuple2 &tuple, Protocol protocol, uint32_t vlan)
+      : BasicSvcBase<Addr>(tuple, BasicSvcBase<Addr>::kVirt),
+        rs_vec_(ALLOC),
+        bounds_(ALLOC),
+        servers_(ALLOC),
+        vlan_(vlan),
+        protocol_(protocol),
+        quic_server_id_len_(0),
+        forward_(Forward::kFullNat),
+        selector_(Selector::kHash),
+        ramp_(Ramp::kLinear),
+        slow_start_(0),
+        mss_(UINT16_MAX),
+        has_overflow_(false),
+        persist_timeout_(0),
+        // Avoid matching stale sessions of the vs with the same tuple
+        version_(W_CURRENT->random()->Integer()) {
     W_DVLOG(1) << "creating: " << tuple;
     // rs_vec_.reserve(CONFIG.svc.max_real_per_virtual);
   }
 
+  typename RealSvc::Ptr select(const Tuple2 &ctuple);
+  typename RealSvc::Ptr select_by_hash(const Tuple2 &ctuple);
+  typename RealSvc::Ptr select_by_latency(const Tuple2 &ctuple);
+
+  uint64_t ramp_weight(const Member &member) const;
+  // Rebuild the cumulative weights starting from 'from'
+  void rebuild_bounds(size_t from);
+  // Rebuild the sorted server ids of members
+  void rebuild_servers();
+  // Return the index of member that 'point' falls in
+  size_t find_member(uint64_t point) const;
+
   RsVec rs_vec_;
+  vector<uint64_t> bounds_;
+  vector<std::pair<uint64_t, RealSvc *>> servers_;
+
+  uint32_t vlan_;
+  Protocol protocol_;
+  uint8_t quic_server_id_len_;
+  Forward forward_;
+  Selector selector_;
+  Ramp ramp_;
+  uint16_t slow_start_;
+  uint16_t mss_;
+
+  Tuple2 overflow_;
+  bool has_overflow_;
+
+  uint32_t persist_timeout_;
+  uint32_t version_;
 
   friend RealSvc;
-  friend class SvcTable;
+  friend class BasicSvcTable<Addr>;
 
-  DISALLOW_IMPLICIT_CONSTRUCTORS(VirtSvc);
+  DISALLOW_IMPLICIT_CONSTRUCTORS(BasicVirtSvc);
 };
 
-static_assert(sizeof(VirtSvc) == 128);
+using SvcBase = BasicSvcBase<be32_t>;
+using RealSvc = BasicRealSvc<be32_t>;
+using VirtSvc = BasicVirtSvc<be32_t>;
+using Ipv6SvcBase = BasicSvcBase<Ipv6::Address>;
+using Ipv6RealSvc = BasicRealSvc<Ipv6::Address>;
+using Ipv6VirtSvc = BasicVirtSvc<Ipv6::Address>;
+
+static_assert(sizeof(RealSvc) == 320);
+static_assert(sizeof(VirtSvc) == 320);
+static_assert(sizeof(Ipv6RealSvc) == 320);
+static_assert(sizeof(Ipv6VirtSvc) == 384);
 
 }  // namespace xlb::conntrack
@@ -1,17 +1,31 @@
 #include "conntrack/table.h"
+#include "conntrack/persist.h"
+
+#include "runtime/exec.h"
 
 namespace xlb::conntrack {
 
-VirtSvc::Ptr SvcTable::FindVs(const Tuple2 &tuple) {
-  VsMap::Entry *entry = vs_map_.Find(tuple);
+template <typename Addr>
+typename BasicVirtSvc<Addr>::Ptr BasicSvcTable<Addr>::FindVs(
+    const Tuple2 &tuple, Protocol protocol) {
+  auto &map = vs_map(protocol);
 
-  if (entry != nullptr)
-    return entry->value;
-  else
-    return {};
+  if constexpr (is_ipv4_v<Addr>) {
+    typename VsMap::Entry *entry = map.Find(tuple);
+
+    if (entry != nullptr) return entry->value;
+  } else {
+    auto iter = map.find(tuple);
+
+    if (iter != map.end()) return iter->second;
+  }
+
+  return {};
 }
 
-RealSvc::Ptr SvcTable::FindRs(const Tuple2 &tuple) {
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicSvcTable<Addr>::FindRs(
+    const Tuple2 &tuple) {
   auto iter = rs_map_.find(tuple);
 
   if (iter != rs_map_.end()) return {iter->second};
@@ -19,24 +33,41 @@ RealSvc::Ptr SvcTable::FindRs(const Tuple2 &tuple) {
   return {};
 }
 
-VirtSvc::Ptr SvcTable::AddVs(const Tuple2 &tuple) {
-  VsMap::Entry *entry = vs_map_.EmplaceUnsafe(tuple, nullptr);
+template <typename Addr>
+typename BasicVirtSvc<Addr>::Ptr BasicSvcTable<Addr>::AddVs(
+    const Tuple2 &tuple, Protocol protocol, uint32_t vlan) {
+  auto &map = vs_map(protocol);
+  typename VirtSvc::Ptr *value;
+
+  if constexpr (is_ipv4_v<Addr>) {
+    typename VsMap::Entry *entry = map.EmplaceUnsafe(tuple, nullptr);
+
+    // There is a very small probability of returning nullptr
+    if (!entry) {
+      last_error_ = "number of conflicts exceeds the limit";
+      return {};
+    }
 
-  // There is a very small probability of returning nullptr
-  if (!entry) {
-    last_error_ = "number of conflicts exceeds the limit";
-    return {};
+    value = &entry->value;
+  } else {
+    value = &map.try_emplace(tuple, nullptr).first->second;
   }
 
-  DCHECK(!entry->value);
+  DCHECK(!*value);
 
   W_DVLOG(1) << "creating VirtSvc: " << tuple;
-  entry->value = new VirtSvc(tuple);
+  *value = new VirtSvc(tuple, protocol, vlan);
 
-  return {entry->value};
+  auto &vip = vip_map_.try_emplace(tuple.ip, Vip{0, vlan}).first->second;
+  DCHECK_EQ(vip.vlan, vlan);
+  ++vip.refs;
+
+  return {*value};
 }
 
-RealSvc::Ptr SvcTable::AddRs(const Tuple2 &tuple) {
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicSvcTable<Addr>::AddRs(
+    const Tuple2 &tuple) {
   auto pair = rs_map_.try_emplace(tuple, nullptr);
 
   // Recycling rs that have not been released yet
@@ -50,15 +81,17 @@ RealSvc::Ptr SvcTable::AddRs(const Tuple2 &tuple) {
   return {pair.first->second};
 }
 
-std::pair<bool, SvcTable::Hint> SvcTable::RsAttached(VirtSvc::Ptr vs,
-                                                     RealSvc::Ptr rs) {
+template <typename Addr>
+std::pair<bool, typename BasicSvcTable<Addr>::Hint>
+BasicSvcTable<Addr>::RsAttached(typename VirtSvc::Ptr vs,
+                                typename RealSvc::Ptr rs) {
   DCHECK_NOTNULL(vs);
   DCHECK_NOTNULL(rs);
 
   auto range = rs_vs_map_.equal_range(rs->tuple_);
 
   for (auto it = range.first; it != range.second; ++it)
-    if (it->second == vs->tuple_) return {true, it};
+    if (it->second == vs.get()) return {true, it};
 
   return {false, {}};
 }
@@ -69,20 +102,29 @@ bool SvcTable::RsDetached(RealSvc::Ptr rs) {
 }
  */
 
-RealSvc::Ptr SvcTable::AttachRs(VirtSvc::Ptr vs, RealSvc::Ptr rs) {
+template <typename Addr>
+typename BasicRealSvc<Addr>::Ptr BasicSvcTable<Addr>::AttachRs(
+    typename VirtSvc::Ptr vs, typename RealSvc::Ptr rs, uint32_t weight,
+    uint64_t server_id) {
   DCHECK_NOTNULL(vs);
   DCHECK_NOTNULL(rs);
 
   W_DVLOG(1) << "attaching RealSvc: " << rs->tuple_
-             << " to VirtSvc: " << vs->tuple_;
+             << " to VirtSvc: " << vs->tuple_ << " weight: " << weight;
   // TODO: is it safe ?
-  vs->rs_vec_.emplace_back(rs);
-  rs_vs_map_.emplace(rs->tuple_, vs->tuple_);
+  auto &member = vs->rs_vec_.emplace_back(
+      typename VirtSvc::Member{rs, weight, 0, W_TSC, server_id});
+  member.effective = vs->ramp_weight(member);
+  vs->rebuild_bounds(vs->rs_vec_.size() - 1);
+  if (server_id != 0) vs->rebuild_servers();
+  rs_vs_map_.emplace(rs->tuple_, vs.get());
 
   return rs;
 }
 
-void SvcTable::DetachRs(VirtSvc::Ptr vs, RealSvc::Ptr rs, Hint it) {
+template <typename Addr>
+void BasicSvcTable<Addr>::DetachRs(typename VirtSvc::Ptr vs,
+                                   typename RealSvc::Ptr rs, Hint it) {
   DCHECK_NOTNULL(vs);
   DCHECK_NOTNULL(rs);
   DCHECK(it != rs_vs_map_.end());
@@ -90,31 +132,112 @@ void SvcTable::DetachRs(VirtSvc::Ptr vs, RealSvc::Ptr rs, Hint it) {
   W_DVLOG(1) << "detaching RealSvc: " << rs->tuple_
              << " to VirtSvc: " << vs->tuple_;
 
-  remove_erase_if(vs->rs_vec_,
-                  [&rs](auto &_rs) { return _rs->tuple_ == rs->tuple_; });
+  auto member = find_if(vs->rs_vec_, [&rs](auto &member) {
+    return member.rs->tuple_ == rs->tuple_;
+  });
+  auto from = member - vs->rs_vec_.begin();
+
+  vs->rs_vec_.erase(member);
+  vs->rebuild_bounds(from);
+  vs->rebuild_servers();
+  ++vs->version_;
   rs_vs_map_.erase(it);
 }
 
-void SvcTable::RemoveVs(VirtSvc::Ptr vs) {
+template <typename Addr>
+void BasicSvcTable<Addr>::RemoveVs(typename VirtSvc::Ptr vs) {
   DCHECK_NOTNULL(vs);
 
   W_DVLOG(1) << "removing VirtSvc: " << vs->tuple_;
 
-  for (auto &rs : vs->rs_vec_) {
-    auto range = rs_vs_map_.equal_range(rs->tuple_);
+  for (auto &member : vs->rs_vec_) {
+    auto range = rs_vs_map_.equal_range(member.rs->tuple_);
     auto it = range.first;
     for (; it != range.second; ++it)
-      if (it->second == vs->tuple_) break;
+      if (it->second == vs.get()) break;
 
     rs_vs_map_.erase(it);
   }
 
   vs->rs_vec_.clear();
-  vs_map_.Remove(vs->tuple_);
+  vs->bounds_.clear();
+  vs->servers_.clear();
+
+  auto vip = vip_map_.find(vs->tuple_.ip);
+  if (vip != vip_map_.end() && --vip->second.refs == 0) vip_map_.erase(vip);
+
+  if constexpr (is_ipv4_v<Addr>)
+    vs_map(vs->protocol_).Remove(vs->tuple_);
+  else
+    vs_map(vs->protocol_).erase(vs->tuple_);
+}
+
+template <typename Addr>
+size_t BasicSvcTable<Addr>::DetectOutliers() {
+  if (W_TSC < outlier_tsc_) return 0;
+  outlier_tsc_ = W_TSC + CONFIG.outlier.interval * tsc_ms;
+
+  size_t changed = 0;
+
+  for (auto &entry : rs_map_) {
+    auto *rs = entry.second;
+    if (!rs->DetectOutlier()) continue;
+
+    ++changed;
+    Exec::InSlaves([tuple = rs->tuple_, ejected = rs->ejected()]() {
+      // Maybe destroyed lazily
+      auto rs = STABLE_OF(Addr).FindRs(tuple);
+      if (rs) rs->set_ejected(ejected);
+    });
+  }
+
+  return changed;
+}
+
+template <typename Addr>
+size_t BasicSvcTable<Addr>::UpdateRtt() {
+  if (W_TSC < rtt_tsc_) return 0;
+  // Follow the period of committing metrics in slaves
+  rtt_tsc_ = W_TSC + SvcBase::kTimerStart * tsc_ms;
+
+  for (auto &entry : rs_map_) entry.second->metrics_->UpdateRtt();
+  ForeachVs([](auto *vs) { vs->metrics_->UpdateRtt(); });
+
+  return rs_map_.size() + CountVs();
+}
+
+template <typename Addr>
+size_t BasicSvcTable<Addr>::BalanceConns() {
+  if (W_TSC < balance_tsc_) return 0;
+  // Follow the period of committing metrics in slaves
+  balance_tsc_ = W_TSC + SvcBase::kTimerStart * tsc_ms;
+
+  size_t balanced = 0;
+
+  for (auto &entry : rs_map_) {
+    auto *rs = entry.second;
+    if (rs->max_conns_ == 0) continue;
+
+    ++balanced;
+
+    auto active = rs->metrics_->active_conns_.load(std::memory_order_relaxed);
+    uint32_t left = active < rs->max_conns_ ? rs->max_conns_ - active : 0;
+
+    // Each slave takes its part of what is left
+    Exec::InSlaves([tuple = rs->tuple_, left]() {
+      // Maybe destroyed lazily
+      auto rs = STABLE_OF(Addr).FindRs(tuple);
+      if (rs)
+        rs->GrantConns(split_evenly(left, CONFIG.slave_cores.size(), W_ID));
+    });
+  }
+
+  return balanced;
 }
 
-Conn *ConnTable::Find(Tuple4 &tuple) {
-  IdxMap::Entry *entry = idx_map_.Find(tuple);
+template <typename Addr>
+BasicConn<Addr> *BasicConnTable<Addr>::Find(Tuple4 &tuple) {
+  typename IdxMap::Entry *entry = idx_map_.Find(key(tuple));
 
   if (entry == nullptr) return nullptr;
 
@@ -123,18 +246,32 @@ Conn *ConnTable::Find(Tuple4 &tuple) {
   DCHECK_NOTNULL(conn->virt());
   DCHECK_NOTNULL(conn->real());
 
+  // Fingerprints collided
+  if constexpr (!is_ipv4_v<Addr>)
+    if (unlikely(!conn->Match(tuple))) return nullptr;
+
   return conn;
 }
 
-Conn *ConnTable::Get(xlb::conntrack::VirtSvc::Ptr vs_ptr,
-                     const xlb::conntrack::Tuple2 &cli_tp) {
-  IdxMap::Entry *orig_ent = idx_map_.Emplace({cli_tp, vs_ptr->tuple()}, 0);
+template <typename Addr>
+BasicConn<Addr> *BasicConnTable<Addr>::Get(typename VirtSvc::Ptr vs_ptr,
+                                            const Tuple2 &cli_tp) {
+  Tuple4 orig_tp{cli_tp, vs_ptr->tuple()};
+  typename IdxMap::Entry *orig_ent = idx_map_.Emplace(key(orig_tp), 0);
 
   // Collision exceeded
   if (unlikely(orig_ent == nullptr)) return nullptr;
 
   // Already exist, return directly
-  if (unlikely(orig_ent->value != 0)) return &conns_[orig_ent->value];
+  if (unlikely(orig_ent->value != 0)) {
+    auto conn = &conns_[orig_ent->value];
+
+    // Fingerprints collided
+    if constexpr (!is_ipv4_v<Addr>)
+      if (unlikely(!conn->Match(orig_tp))) return nullptr;
+
+    return conn;
+  }
 
   // The table is full
   if (unlikely(idx_pool_.empty())) {
@@ -144,7 +281,13 @@ Conn *ConnTable::Get(xlb::conntrack::VirtSvc::Ptr vs_ptr,
   }
 
   // TODO: avoid adding reference counts
-  auto rs_ptr = vs_ptr->SelectRs(cli_tp);
+  typename BasicRealSvc<Addr>::Ptr rs_ptr;
+  // Source ip persistence is only available for ipv4
+  if constexpr (is_ipv4_v<Addr>)
+    rs_ptr = vs_ptr->persist_timeout() ? PTABLE.Select(vs_ptr, cli_tp)
+                                       : vs_ptr->SelectRs(cli_tp);
+  else
+    rs_ptr = vs_ptr->SelectRs(cli_tp);
   // No rs attached to vs
   if (unlikely(!rs_ptr)) {
     // Clean up the map
@@ -152,9 +295,13 @@ Conn *ConnTable::Get(xlb::conntrack::VirtSvc::Ptr vs_ptr,
     return nullptr;
   }
 
-  Tuple2 loc_tp;
+  // Replies of DR and tunnels go from rs to the client directly, so the reply
+  // entry is not needed. The local tuple is the outer source of tunnels.
+  auto forward = vs_ptr->forward();
+
+  Tuple2 loc_tp{Addr{}, be16_t(0)};
   // Local tuple runs out
-  if (unlikely(!rs_ptr->GetLocal(loc_tp))) {
+  if (forward != Forward::kDr && unlikely(!rs_ptr->GetLocal(loc_tp))) {
     // Clean up the map
     idx_map_.Remove(orig_ent->key);
     return nullptr;
@@ -163,20 +310,28 @@ Conn *ConnTable::Get(xlb::conntrack::VirtSvc::Ptr vs_ptr,
   auto idx = idx_pool_.top();
   idx_pool_.pop();
 
-  // Since the original does not exist, we think that the reply is the same, so
-  // use unsafe here for performance
-  IdxMap::Entry *rep_ent =
-      idx_map_.EmplaceUnsafe({rs_ptr->tuple(), loc_tp}, idx);
-
-  // Collision exceeded
-  if (unlikely(rep_ent == nullptr)) {
-    // Release index
-    idx_pool_.push(idx);
-    // Release local tuple
-    rs_ptr->PutLocal(loc_tp);
-    // Clean up the map
-    idx_map_.Remove(orig_ent->key);
-    return nullptr;
+  if (forward == Forward::kFullNat) {
+    typename IdxMap::Entry *rep_ent;
+    // Since the original does not exist, we think that the reply is the same,
+    // so use unsafe here for performance. But fingerprints may collide.
+    if constexpr (is_ipv4_v<Addr>) {
+      rep_ent = idx_map_.EmplaceUnsafe(key({rs_ptr->tuple(), loc_tp}), idx);
+    } else {
+      rep_ent = idx_map_.Emplace(key({rs_ptr->tuple(), loc_tp}), idx);
+      if (rep_ent != nullptr && unlikely(rep_ent->value != idx))
+        rep_ent = nullptr;
+    }
+
+    // Collision exceeded
+    if (unlikely(rep_ent == nullptr)) {
+      // Release index
+      idx_pool_.push(idx);
+      // Release local tuple
+      rs_ptr->PutLocal(loc_tp);
+      // Clean up the map
+      idx_map_.Remove(orig_ent->key);
+      return nullptr;
+    }
   }
 
   orig_ent->value = idx;
@@ -190,9 +345,17 @@ Conn *ConnTable::Get(xlb::conntrack::VirtSvc::Ptr vs_ptr,
 
   conn->state_ = TCP_CONNTRACK_NONE;
 
+  rs_ptr->IncrActiveConns();
+  vs_ptr->IncrActiveConns();
+
   W_DVLOG(2) << "created Conn: " << *conn;
 
   return conn;
 }
 
+template class BasicSvcTable<be32_t>;
+template class BasicConnTable<be32_t>;
+template class BasicSvcTable<Ipv6::Address>;
+template class BasicConnTable<Ipv6::Address>;
+
 }  // namespace xlb::conntrack
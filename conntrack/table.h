@@ -8,76 +8,154 @@
 
 namespace xlb::conntrack {
 
-class SvcTable {
+template <typename Addr>
+class BasicSvcTable {
  private:
-  using VsMap = XMap<Tuple2, VirtSvc::Ptr>;
+  using Tuple2 = BasicTuple2<Addr>;
+  using SvcBase = BasicSvcBase<Addr>;
+  using RealSvc = BasicRealSvc<Addr>;
+  using VirtSvc = BasicVirtSvc<Addr>;
+  // Ipv6 tuples are too large for 'XMap', virtual services are only looked up
+  // by SYN anyway
+  using VsMap =
+      std::conditional_t<is_ipv4_v<Addr>, XMap<Tuple2, typename VirtSvc::Ptr>,
+                         unordered_map<Tuple2, typename VirtSvc::Ptr>>;
   using RsMap = unordered_map<Tuple2, RealSvc *>;
-  using RelatedMap = unordered_multimap<Tuple2, Tuple2>;
-  using Hint = RelatedMap::iterator;
+  struct Vip {
+    uint32_t refs;
+    uint32_t vlan;
+  };
+  using VipMap = unordered_map<Addr, Vip>;
+  using RelatedMap = unordered_multimap<Tuple2, VirtSvc *>;
+  using Hint = typename RelatedMap::iterator;
 
  public:
-  SvcTable()
-      : vs_map_(CONFIG.svc.max_virtual_service),
+  BasicSvcTable()
+      : vs_map_(vs_map_arg()),
+        udp_vs_map_(vs_map_arg()),
         rs_map_(ALLOC),
         rs_vs_map_(ALLOC),
-        timer_(W_TSC) {
+        vip_map_(ALLOC),
+        timer_(W_TSC),
+        outlier_tsc_(W_TSC),
+        rtt_tsc_(W_TSC),
+        balance_tsc_(W_TSC) {
+    if constexpr (!is_ipv4_v<Addr>) {
+      vs_map_.reserve(CONFIG.svc.max_virtual_service);
+      udp_vs_map_.reserve(CONFIG.svc.max_virtual_service);
+    }
     rs_map_.reserve(CONFIG.svc.max_real_service);
     rs_vs_map_.reserve(CONFIG.svc.max_real_per_virtual *
                        CONFIG.svc.max_virtual_service);
+    vip_map_.reserve(CONFIG.svc.max_virtual_service);
 
     RealSvc::InitPrototype();
     W_LOG(INFO) << "initializing succeed";
   }
-  ~SvcTable() = default;
+  ~BasicSvcTable() = default;
 
   // TODO: more intuitive interface
-  VirtSvc::Ptr FindVs(const Tuple2 &tuple);
-  RealSvc::Ptr FindRs(const Tuple2 &tuple);
+  typename VirtSvc::Ptr FindVs(const Tuple2 &tuple,
+                               Protocol protocol = Protocol::kTcp);
+  typename RealSvc::Ptr FindRs(const Tuple2 &tuple);
 
-  // WARING: make sure vs does not exists
-  VirtSvc::Ptr AddVs(const Tuple2 &tuple);
-  void RemoveVs(VirtSvc::Ptr vs);
+  // WARING: make sure vs does not exists and 'vlan' does not conflict
+  typename VirtSvc::Ptr AddVs(const Tuple2 &tuple,
+                              Protocol protocol = Protocol::kTcp,
+                              uint32_t vlan = 0);
+  void RemoveVs(typename VirtSvc::Ptr vs);
 
-  RealSvc::Ptr AddRs(const Tuple2 &tuple);
+  typename RealSvc::Ptr AddRs(const Tuple2 &tuple);
   // WARING: make sure rs is detached
-  RealSvc::Ptr AttachRs(VirtSvc::Ptr vs, RealSvc::Ptr rs);
+  typename RealSvc::Ptr AttachRs(typename VirtSvc::Ptr vs,
+                                 typename RealSvc::Ptr rs, uint32_t weight,
+                                 uint64_t server_id = 0);
   // This should only be called in the master to confirm whether the rs-metric
   // in the metric-pool can be purged
   // bool RsDetached(RealSvc::Ptr rs);
 
-  std::pair<bool, Hint> RsAttached(VirtSvc::Ptr vs, RealSvc::Ptr rs);
-  void DetachRs(VirtSvc::Ptr vs, RealSvc::Ptr rs, Hint it);
+  std::pair<bool, Hint> RsAttached(typename VirtSvc::Ptr vs,
+                                   typename RealSvc::Ptr rs);
+  void DetachRs(typename VirtSvc::Ptr vs, typename RealSvc::Ptr rs, Hint it);
+
+  // Whether any virtual service of either protocol listens on 'ip' in 'vlan'
+  bool IsVip(const Addr &ip, uint32_t vlan) {
+    auto it = vip_map_.find(ip);
+    return it != vip_map_.end() && it->second.vlan == vlan;
+  }
+
+  // Virtual services on the same ip must be in the same vlan
+  bool VlanConflicts(const Addr &ip, uint32_t vlan) {
+    auto it = vip_map_.find(ip);
+    return it != vip_map_.end() && it->second.vlan != vlan;
+  }
 
   const std::string &LastError() { return last_error_; }
 
   size_t Sync() { return timer_.AdvanceTo(W_TSC); }
 
+  // This should only be called in the trivial, the result of detection is
+  // broadcast to slaves
+  size_t DetectOutliers();
+  // This should only be called in the trivial, update percentiles of rtt
+  size_t UpdateRtt();
+  // This should only be called in the trivial, share the remaining connections
+  // of rs with limit among slaves
+  size_t BalanceConns();
+
   auto CountRs() { return rs_vs_map_.size(); }
-  auto CountRs(VirtSvc::Ptr vs) { return vs->rs_vec_.size(); }
-  auto CountVs() { return vs_map_.Size(); }
+  auto CountRs(typename VirtSvc::Ptr vs) { return vs->rs_vec_.size(); }
+  size_t CountVs() {
+    if constexpr (is_ipv4_v<Addr>)
+      return vs_map_.Size() + udp_vs_map_.Size();
+    else
+      return vs_map_.size() + udp_vs_map_.size();
+  }
 
   template <typename T>
-  void ForeachRs(VirtSvc::Ptr vs, T &&func) {
-    for_each(vs->rs_vec_, [&func](auto &rs) { func(rs.get()); });
+  void ForeachRs(typename VirtSvc::Ptr vs, T &&func) {
+    for_each(vs->rs_vec_, [&func](auto &member) { func(member.rs.get()); });
   }
   template <typename T>
   void ForeachRs(T &&func) {
-    for_each(rs_map_, [&func](auto &entry) { func(entry->second); });
+    for_each(rs_map_, [&func](auto &entry) { func(entry.second); });
   }
   template <typename T>
   void ForeachVs(T &&func) {
-    std::for_each(vs_map_.begin(), vs_map_.end(),
-                  [&func](auto &entry) { func(entry.value.get()); });
+    for (auto *map : {&vs_map_, &udp_vs_map_}) {
+      if constexpr (is_ipv4_v<Addr>)
+        std::for_each(map->begin(), map->end(),
+                      [&func](auto &entry) { func(entry.value.get()); });
+      else
+        for_each(*map, [&func](auto &entry) { func(entry.second.get()); });
+    }
   }
 
  private:
+  static auto vs_map_arg() {
+    if constexpr (is_ipv4_v<Addr>)
+      return CONFIG.svc.max_virtual_service;
+    else
+      return ALLOC;
+  }
+
+  VsMap &vs_map(Protocol protocol) {
+    return protocol == Protocol::kUdp ? udp_vs_map_ : vs_map_;
+  }
+
   VsMap vs_map_;
+  VsMap udp_vs_map_;
   // In order to reuse detached rs, since local-tuple-pool in rs must be unique
   // for the same rs-tuple in the same worker to avoid collision in snat
   RsMap rs_map_;
   RelatedMap rs_vs_map_;
+  // Number of virtual services on each ip, which arp and echo are answered for
+  VipMap vip_map_;
 
   TimerWheel<SvcBase> timer_;
+  uint64_t outlier_tsc_;
+  uint64_t rtt_tsc_;
+  uint64_t balance_tsc_;
 
   std::string last_error_;
 
@@ -85,13 +163,22 @@ class SvcTable {
   friend RealSvc;
   friend SvcBase;
 
-  DISALLOW_COPY_AND_ASSIGN(SvcTable);
+  DISALLOW_COPY_AND_ASSIGN(BasicSvcTable);
 };
 
-class ConnTable {
+template <typename Addr>
+class BasicConnTable {
+ private:
+  using Tuple2 = BasicTuple2<Addr>;
+  using Tuple4 = BasicTuple4<Addr>;
+  using VirtSvc = BasicVirtSvc<Addr>;
+  using Conn = BasicConn<Addr>;
+
  public:
-  ConnTable()
-      : conns_(align_ceil_pow2(CONFIG.svc.max_conn), ALLOC),
+  BasicConnTable()
+      : conns_(align_ceil_pow2(is_ipv4_v<Addr> ? CONFIG.svc.max_conn
+                                               : CONFIG.svc.max_ipv6_conn),
+               ALLOC),
         idx_map_(conns_.capacity()),
         idx_pool_(make_vector<uint32_t>(conns_.capacity())),
         timer_(W_TSC) {
@@ -99,15 +186,29 @@ class ConnTable {
     for (auto idx : irange(1ul, conns_.capacity())) idx_pool_.push(idx);
     W_LOG(INFO) << "initializing succeed";
   }
-  ~ConnTable() = default;
+  ~BasicConnTable() = default;
 
   Conn *Find(Tuple4 &tuple);
-  Conn *Get(VirtSvc::Ptr vs_ptr, const Tuple2 &cli_tp);
+  Conn *Get(typename VirtSvc::Ptr vs_ptr, const Tuple2 &cli_tp);
 
   size_t Sync() { return timer_.AdvanceTo(W_TSC); }
 
+  // Index 0 is never used
+  size_t Count() const { return conns_.capacity() - 1 - idx_pool_.size(); }
+
  private:
-  using IdxMap = XMap<Tuple4, uint32_t>;
+  // Ipv6 tuples are too large for 'XMap', so they are indexed by fingerprints
+  // and the connections found are verified against the tuples
+  using Key = std::conditional_t<is_ipv4_v<Addr>, Tuple4, uint64_t>;
+  using IdxMap = XMap<Key, uint32_t>;
+
+  static Key key(const Tuple4 &tuple) {
+    if constexpr (is_ipv4_v<Addr>)
+      return tuple;
+    else
+      return std::hash<std::string_view>{}(
+          {reinterpret_cast<const char *>(&tuple), sizeof(tuple)});
+  }
 
   vector<Conn> conns_;
   IdxMap idx_map_;
@@ -116,9 +217,14 @@ class ConnTable {
   TimerWheel<Conn> timer_;
 
   friend Conn;
-  DISALLOW_COPY_AND_ASSIGN(ConnTable);
+  DISALLOW_COPY_AND_ASSIGN(BasicConnTable);
 };
 
+using SvcTable = BasicSvcTable<be32_t>;
+using ConnTable = BasicConnTable<be32_t>;
+using Ipv6SvcTable = BasicSvcTable<Ipv6::Address>;
+using Ipv6ConnTable = BasicConnTable<Ipv6::Address>;
+
 }  // namespace xlb::conntrack
 
 namespace xlb {
@@ -129,4 +235,16 @@ namespace xlb {
 #define CTABLE_INIT (UnsafeSingletonTLS<conntrack::ConnTable>::Init)
 #define CTABLE (UnsafeSingletonTLS<conntrack::ConnTable>::instance())
 
+#define STABLE6_INIT (UnsafeSingletonTLS<conntrack::Ipv6SvcTable>::Init)
+#define STABLE6 (UnsafeSingletonTLS<conntrack::Ipv6SvcTable>::instance())
+
+#define CTABLE6_INIT (UnsafeSingletonTLS<conntrack::Ipv6ConnTable>::Init)
+#define CTABLE6 (UnsafeSingletonTLS<conntrack::Ipv6ConnTable>::instance())
+
+// Tables of the family of address type 'A', for the code shared by both
+#define STABLE_OF(A) \
+  (UnsafeSingletonTLS<conntrack::BasicSvcTable<A>>::instance())
+#define CTABLE_OF(A) \
+  (UnsafeSingletonTLS<conntrack::BasicConnTable<A>>::instance())
+
 }  // namespace xlb
@@ -4,75 +4,86 @@
 
 namespace xlb::conntrack {
 
-struct [[gnu::packed]] Tuple2 {
-  Tuple2(const be32_t &_ip, const be16_t &_port) : ip(_ip), port(_port) {}
+// 'Addr' is either 'be32_t' of ipv4 or 'Ipv6::Address'
+template <typename Addr>
+struct [[gnu::packed]] BasicTuple2 {
+  BasicTuple2(const Addr &_ip, const be16_t &_port) : ip(_ip), port(_port) {}
 
-  Tuple2() = default;
-  ~Tuple2() = default;
+  BasicTuple2() = default;
+  ~BasicTuple2() = default;
 
-  be32_t ip;
+  Addr ip;
   be16_t port;
 
-  friend std::ostream &operator<<(std::ostream &os, const Tuple2 &tuple) {
-    os << "[ip: " << headers::ToIpv4Address(tuple.ip)
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const BasicTuple2 &tuple) {
+    os << "[ip: " << headers::ToIpAddress(tuple.ip)
        << " port: " << tuple.port.value() << "]";
     return os;
   }
 };
 
-static_assert(sizeof(Tuple2) == 6);
-
-struct [[gnu::packed]] Tuple4 {
-  Tuple4(const Tuple2 &_src, const Tuple2 &_dst) : src(_src), dst(_dst) {}
+template <typename Addr>
+struct [[gnu::packed]] BasicTuple4 {
+  BasicTuple4(const BasicTuple2<Addr> &_src, const BasicTuple2<Addr> &_dst)
+      : src(_src), dst(_dst) {}
 
-  Tuple4() = default;
-  ~Tuple4() = default;
+  BasicTuple4() = default;
+  ~BasicTuple4() = default;
 
-  Tuple2 src;
-  Tuple2 dst;
+  BasicTuple2<Addr> src;
+  BasicTuple2<Addr> dst;
 
-  friend std::ostream &operator<<(std::ostream &os, const Tuple4 &tuple) {
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const BasicTuple4 &tuple) {
     os << "[src: " << tuple.src << " dst: " << tuple.dst << "]";
     return os;
   }
 };
 
+using Tuple2 = BasicTuple2<be32_t>;
+using Tuple4 = BasicTuple4<be32_t>;
+using Ipv6Tuple2 = BasicTuple2<Ipv6::Address>;
+using Ipv6Tuple4 = BasicTuple4<Ipv6::Address>;
+
+static_assert(sizeof(Tuple2) == 6);
 static_assert(sizeof(Tuple4) == 12);
+static_assert(sizeof(Ipv6Tuple2) == 18);
+static_assert(sizeof(Ipv6Tuple4) == 36);
 
 }  // namespace xlb::conntrack
 
 namespace std {
 
-template <>
-struct hash<xlb::conntrack::Tuple2> {
-  size_t operator()(const xlb::conntrack::Tuple2 &key) const {
-    return hash_combine(hash<xlb::be32_t>{}(key.ip),
-                        hash<xlb::be16_t>{}(key.port));
+template <typename Addr>
+struct hash<xlb::conntrack::BasicTuple2<Addr>> {
+  size_t operator()(const xlb::conntrack::BasicTuple2<Addr> &key) const {
+    return hash_combine(hash<Addr>{}(key.ip), hash<xlb::be16_t>{}(key.port));
   }
 };
 
-template <>
-struct equal_to<xlb::conntrack::Tuple2> {
-  bool operator()(const xlb::conntrack::Tuple2 &lhs,
-                  const xlb::conntrack::Tuple2 &rhs) const {
+template <typename Addr>
+struct equal_to<xlb::conntrack::BasicTuple2<Addr>> {
+  bool operator()(const xlb::conntrack::BasicTuple2<Addr> &lhs,
+                  const xlb::conntrack::BasicTuple2<Addr> &rhs) const {
     return lhs.ip == rhs.ip && lhs.port == rhs.port;
   }
 };
 
-template <>
-struct hash<xlb::conntrack::Tuple4> {
-  size_t operator()(const xlb::conntrack::Tuple4 &key) const {
-    return hash_combine(hash<xlb::conntrack::Tuple2>{}(key.dst),
-                        hash<xlb::conntrack::Tuple2>{}(key.src));
+template <typename Addr>
+struct hash<xlb::conntrack::BasicTuple4<Addr>> {
+  size_t operator()(const xlb::conntrack::BasicTuple4<Addr> &key) const {
+    return hash_combine(hash<xlb::conntrack::BasicTuple2<Addr>>{}(key.dst),
+                        hash<xlb::conntrack::BasicTuple2<Addr>>{}(key.src));
   }
 };
 
-template <>
-struct equal_to<xlb::conntrack::Tuple4> {
-  bool operator()(const xlb::conntrack::Tuple4 &lhs,
-                  const xlb::conntrack::Tuple4 &rhs) const {
-    return equal_to<xlb::conntrack::Tuple2>{}(lhs.src, rhs.src) &&
-           equal_to<xlb::conntrack::Tuple2>{}(lhs.dst, rhs.dst);
+template <typename Addr>
+struct equal_to<xlb::conntrack::BasicTuple4<Addr>> {
+  bool operator()(const xlb::conntrack::BasicTuple4<Addr> &lhs,
+                  const xlb::conntrack::BasicTuple4<Addr> &rhs) const {
+    return equal_to<xlb::conntrack::BasicTuple2<Addr>>{}(lhs.src, rhs.src) &&
+           equal_to<xlb::conntrack::BasicTuple2<Addr>>{}(lhs.dst, rhs.dst);
   }
 };
 
@@ -80,25 +91,28 @@ struct equal_to<xlb::conntrack::Tuple4> {
 
 namespace xlb {
 
-inline bool operator==(const conntrack::Tuple2 &lhs,
-                       const conntrack::Tuple2 &rhs) {
-  return std::equal_to<conntrack::Tuple2>{}(lhs, rhs);
+template <typename Addr>
+inline bool operator==(const conntrack::BasicTuple2<Addr> &lhs,
+                       const conntrack::BasicTuple2<Addr> &rhs) {
+  return std::equal_to<conntrack::BasicTuple2<Addr>>{}(lhs, rhs);
 }
 
-inline bool operator!=(const conntrack::Tuple2 &lhs,
-                       const conntrack::Tuple2 &rhs) {
-  return !std::equal_to<conntrack::Tuple2>{}(lhs, rhs);
+template <typename Addr>
+inline bool operator!=(const conntrack::BasicTuple2<Addr> &lhs,
+                       const conntrack::BasicTuple2<Addr> &rhs) {
+  return !std::equal_to<conntrack::BasicTuple2<Addr>>{}(lhs, rhs);
 }
 
-inline bool operator==(const conntrack::Tuple4 &lhs,
-                       const conntrack::Tuple4 &rhs) {
-  return std::equal_to<conntrack::Tuple4>{}(lhs, rhs);
+template <typename Addr>
+inline bool operator==(const conntrack::BasicTuple4<Addr> &lhs,
+                       const conntrack::BasicTuple4<Addr> &rhs) {
+  return std::equal_to<conntrack::BasicTuple4<Addr>>{}(lhs, rhs);
 }
 
-inline bool operator!=(const conntrack::Tuple4 &lhs,
-                       const conntrack::Tuple4 &rhs) {
-  return !std::equal_to<conntrack::Tuple4>{}(lhs, rhs);
+template <typename Addr>
+inline bool operator!=(const conntrack::BasicTuple4<Addr> &lhs,
+                       const conntrack::BasicTuple4<Addr> &rhs) {
+  return !std::equal_to<conntrack::BasicTuple4<Addr>>{}(lhs, rhs);
 }
 
 }  // namespace xlb
-
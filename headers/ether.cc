@@ -30,4 +30,28 @@ void Address::Randomize() {
   bytes[0] |= 0x02;  // locally administered
 }
 
+bool ParseVlan(const std::string &str, uint32_t *vlan) {
+  unsigned outer = 0, inner;
+  int pos = -1;
+
+  if (Parse(str, "%u%n", &inner, &pos) != 1) return false;
+
+  if (size_t(pos) != str.size() &&
+      Parse(str, "%u.%u%n", &outer, &inner, &pos) != 2)
+    return false;
+
+  if (size_t(pos) != str.size() || inner == 0 || inner >= Vlan::kVidMask ||
+      outer >= Vlan::kVidMask)
+    return false;
+
+  *vlan = (outer << 16) | inner;
+  return true;
+}
+
+std::string ToVlan(uint32_t vlan) {
+  if (OuterVid(vlan) == 0) return std::to_string(InnerVid(vlan));
+
+  return std::to_string(OuterVid(vlan)) + "." + std::to_string(InnerVid(vlan));
+}
+
 }  // namespace xlb::headers
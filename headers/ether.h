@@ -80,10 +80,21 @@ struct [[gnu::packed]] Ethernet {
 };
 
 struct [[gnu::packed]] Vlan {
+  static constexpr uint16_t kVidMask = 0x0fff;
+
   be16_t tci;
   be16_t ether_type;
 };
 
+// A vlan of xlb is either a single 802.1q id, or an 802.1ad (QinQ) pair with
+// the outer id in the higher 16 bits, 0 means untagged
+inline uint16_t OuterVid(uint32_t vlan) { return vlan >> 16; }
+inline uint16_t InnerVid(uint32_t vlan) { return vlan & Vlan::kVidMask; }
+
+// In the form of "100" or "outer.inner" such as "200.100"
+bool ParseVlan(const std::string &str, uint32_t *vlan);
+std::string ToVlan(uint32_t vlan);
+
 static_assert(std::is_pod<Ethernet>::value, "not a POD type");
 static_assert(std::is_pod<Ethernet::Address>::value, "not a POD type");
 static_assert(sizeof(Ethernet) == 14, "struct Ethernet is incorrect");
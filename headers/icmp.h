@@ -0,0 +1,37 @@
+#pragma once
+
+#include "headers/common.h"
+
+namespace xlb::headers {
+
+// A basic ICMP header definition, errors are followed by the ip header and at
+// least 8 bytes of the packet that caused them.
+struct [[gnu::packed]] Icmp {
+  enum Type : uint8_t {
+    kEchoReply = 0,
+    kDestUnreachable = 3,
+    kEchoRequest = 8,
+    kTimeExceeded = 11,
+    kParameterProblem = 12,
+  };
+
+  // Codes of 'kDestUnreachable'
+  enum Code : uint8_t {
+    kNetUnreachable = 0,
+    kHostUnreachable = 1,
+    kProtoUnreachable = 2,
+    kPortUnreachable = 3,
+    kFragNeeded = 4,
+  };
+
+  uint8_t type;       // Type.
+  uint8_t code;       // Code.
+  uint16_t checksum;  // Checksum of the whole message.
+  be16_t unused;      // Identifier of echo, unused by errors.
+  be16_t mtu;         // Next-hop mtu of 'kFragNeeded', sequence of echo.
+};
+
+static_assert(std::is_pod<Icmp>::value, "not a POD type");
+static_assert(sizeof(Icmp) == 8, "struct Icmp is incorrect");
+
+}  // namespace xlb::headers
@@ -0,0 +1,24 @@
+#include "headers/ipv6.h"
+
+#include <arpa/inet.h>
+
+namespace xlb::headers {
+
+bool ParseIpv6Address(const std::string &str, Ipv6::Address *addr) {
+  Ipv6::Address parsed;
+
+  if (inet_pton(AF_INET6, str.c_str(), parsed.bytes) != 1) return false;
+
+  *addr = parsed;
+  return true;
+}
+
+std::string ToIpv6Address(const Ipv6::Address &addr) {
+  char str[INET6_ADDRSTRLEN];
+
+  if (inet_ntop(AF_INET6, addr.bytes, str, sizeof(str)) == nullptr) return "";
+
+  return str;
+}
+
+}  // namespace xlb::headers
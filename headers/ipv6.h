@@ -0,0 +1,92 @@
+#pragma once
+
+#include "headers/common.h"
+#include "headers/ip.h"
+
+namespace xlb::headers {
+
+// An IPv6 header definition without extension headers.
+struct [[gnu::packed]] Ipv6 {
+  struct [[gnu::packed]] Address {
+    static constexpr size_t kSize = 16;
+
+    bool operator==(const Address &o) const {
+      return memcmp(bytes, o.bytes, kSize) == 0;
+    }
+
+    bool operator!=(const Address &o) const {
+      return memcmp(bytes, o.bytes, kSize) != 0;
+    }
+
+    uint8_t bytes[kSize];
+  };
+
+  // Values of 'next_header'
+  enum Proto : uint8_t {
+    kHopByHop = 0,
+    kTcp = 6,
+    kUdp = 17,
+    kRouting = 43,
+    kFragment = 44,
+    kEsp = 50,
+    kAh = 51,
+    kIcmp = 58,
+    kNoNext = 59,
+    kDstOpts = 60,
+  };
+
+  uint8_t version() const { return vtc_flow.value() >> 28; }
+
+  be32_t vtc_flow;         // Version, traffic class and flow label.
+  be16_t payload_length;   // Length of the rest of the packet.
+  uint8_t next_header;     // Type of the next header.
+  uint8_t hop_limit;       // Hop limit.
+  Address src;             // Source address.
+  Address dst;             // Destination address.
+};
+
+static_assert(std::is_pod<Ipv6>::value, "not a POD type");
+static_assert(std::is_pod<Ipv6::Address>::value, "not a POD type");
+static_assert(sizeof(Ipv6) == 40, "struct Ipv6 is incorrect");
+
+// return false if string -> address conversion failed (*addr is unmodified)
+bool ParseIpv6Address(const std::string &str, Ipv6::Address *addr);
+
+// address -> string
+std::string ToIpv6Address(const Ipv6::Address &addr);
+
+// Overloaded for the code shared by both families
+inline bool ParseIpAddress(const std::string &str, be32_t *addr) {
+  return ParseIpv4Address(str, addr);
+}
+
+inline bool ParseIpAddress(const std::string &str, Ipv6::Address *addr) {
+  return ParseIpv6Address(str, addr);
+}
+
+inline std::string ToIpAddress(const be32_t &addr) {
+  return ToIpv4Address(addr);
+}
+
+inline std::string ToIpAddress(const Ipv6::Address &addr) {
+  return ToIpv6Address(addr);
+}
+
+// Whether 'Addr' is the address type of ipv4 (otherwise ipv6)
+template <typename Addr>
+constexpr bool is_ipv4_v = std::is_same<Addr, be32_t>::value;
+
+}  // namespace xlb::headers
+
+namespace std {
+
+template <>
+struct hash<xlb::headers::Ipv6::Address> {
+  size_t operator()(const xlb::headers::Ipv6::Address &addr) const {
+    uint64_t words[2];
+    memcpy(words, addr.bytes, sizeof(words));
+    return hash_combine(hash<uint64_t>{}(words[0]), hash<uint64_t>{}(words[1]));
+  }
+};
+
+}  // namespace std
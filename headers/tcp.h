@@ -15,6 +15,16 @@ struct [[gnu::packed]] Tcp {
     kUrg = 0x20,
   };
 
+  // Kinds of options
+  enum Option : uint8_t {
+    kEol = 0,
+    kNop = 1,
+    kMss = 2,
+    // Address of client inserted by load balancers for the toa module of
+    // backends
+    kToa = 254,
+  };
+
   be16_t src_port;  // Source port.
   be16_t dst_port;  // Destination port.
   be32_t seq_num;   // Sequence number.
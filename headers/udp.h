@@ -0,0 +1,18 @@
+#pragma once
+
+#include "headers/common.h"
+
+namespace xlb::headers {
+
+// A basic UDP header definition.
+struct [[gnu::packed]] Udp {
+  be16_t src_port;    // Source port.
+  be16_t dst_port;    // Destination port.
+  be16_t length;      // Length of header and data.
+  uint16_t checksum;  // Checksum, 0 means not computed in ipv4.
+};
+
+static_assert(std::is_pod<Udp>::value, "not a POD type");
+static_assert(sizeof(Udp) == 8, "struct Udp is incorrect");
+
+}  // namespace xlb::headers
@@ -1,22 +1,128 @@
 #include "modules/arp_inc.h"
 
+#include "conntrack/table.h"
+
 namespace xlb::modules {
 
+ArpInc::ArpInc()
+    : slots_(kMaxLearned),
+      // A ring holds one less than its size
+      free_(kMaxLearned + 1),
+      learned_(kMaxLearned + 1),
+      budget_(0),
+      budget_tsc_(0) {
+  ParseIpv4Address(CONFIG.kni.ip_address, &kni_ip_addr_);
+  for (auto &slot : slots_) CHECK(free_.Push(&slot));
+}
+
+void ArpInc::InitInTrivial() {
+  RegisterTask<TS("arp_share")>(
+      [this](Context *) -> Result { return {.packets = share()}; });
+}
+
+size_t ArpInc::share() {
+  Learned *learned[Packet::kMaxBurst];
+  size_t cnt = learned_.Pop(learned, Packet::kMaxBurst);
+
+  if (W_TSC >= budget_tsc_) {
+    budget_ = kMaxSharedPerSec;
+    budget_tsc_ = W_TSC + tsc_sec;
+  }
+
+  for (size_t i = 0; i < cnt; ++i) {
+    Learned l = *learned[i];
+    CHECK(free_.Push(learned[i]));
+
+    uint64_t key = (uint64_t(l.port) << 60) | (uint64_t(l.vlan) << 32) |
+                   l.ip.raw_value();
+
+    auto it = shared_.find(key);
+    if (it != shared_.end() && it->second == l.hw_addr) continue;
+
+    if (budget_ == 0) {
+      W_LOG_EVERY_SECOND(WARNING) << "too many neighbors learned";
+      continue;
+    }
+
+    --budget_;
+
+    // Forgotten all at once, which only costs some updates sent again
+    if (shared_.size() >= kMaxShared) shared_.clear();
+    shared_[key] = l.hw_addr;
+
+    Exec::InSlaves(
+        [l]() { NEIGHBORS.Update(l.port, l.vlan, l.ip, l.hw_addr); });
+  }
+
+  return cnt;
+}
+
+bool ArpInc::owned(uint16_t port, uint32_t vlan, const be32_t &ip) {
+  auto it = CONFIG.local_ip_links.find(ip);
+  if (it != CONFIG.local_ip_links.end())
+    return it->second.port == port && it->second.vlan == vlan;
+
+  return STABLE.IsVip(ip, vlan);
+}
+
+// Replies, gratuitous arp and requests to xlb tell the current address of the
+// sender, which is passed to the trivial since slaves resolve neighbors on
+// their own
+void ArpInc::learn(uint16_t port, uint32_t vlan, const Arp *arp_hdr) {
+  be32_t ip = arp_hdr->sender_ip_addr;
+  Ethernet::Address hw_addr = arp_hdr->sender_hw_addr;
+
+  if (ip == be32_t(0)) return;
+
+  if (arp_hdr->opcode != be16_t(Arp::kReply) &&
+      arp_hdr->target_ip_addr != ip &&
+      !(port == 0 && vlan == 0 && arp_hdr->target_ip_addr == kni_ip_addr_) &&
+      !owned(port, vlan, arp_hdr->target_ip_addr))
+    return;
+
+  NEIGHBORS.Update(port, vlan, ip, hw_addr);
+
+  Learned *learned;
+  if (unlikely(!free_.Pop(learned))) {
+    W_DVLOG(1) << "too many neighbors learned";
+    return;
+  }
+
+  *learned = {port, vlan, ip, hw_addr};
+  CHECK(learned_.Push(learned));
+}
+
 template <>
 void ArpInc::Process<PMD>(Context *ctx, Packet *packet) {
+  auto *eth_hdr = packet->head_data<Ethernet *>();
   auto *arp_hdr = packet->head_data<Arp *>(sizeof(Ethernet));
 
-  if (arp_hdr->opcode == be16_t(Arp::kReply) &&
-      arp_hdr->sender_ip_addr == gw_ip_addr_ &&
-      arp_hdr->sender_hw_addr != gw_hw_addr_) {
-    W_LOG(INFO) << "alter gateway address from: " << gw_hw_addr_
-                << " to: " << arp_hdr->sender_hw_addr;
+  uint16_t port = packet->port();
+  uint32_t vlan = packet->vlan();
+
+  learn(port, vlan, arp_hdr);
 
-    gw_hw_addr_ = arp_hdr->sender_hw_addr;
-    //    asm volatile("" : : "m"(gw_hw_addr_) :);
+  if (arp_hdr->opcode != be16_t(Arp::kRequest) ||
+      !owned(port, vlan, arp_hdr->target_ip_addr)) {
+    Handle<EtherOut, KNI>(ctx, packet);
+    return;
   }
 
-  Handle<EtherOut, KNI>(ctx, packet);
+  // Turn the request into the reply in place
+  be32_t ip = arp_hdr->target_ip_addr;
+
+  arp_hdr->opcode = be16_t(Arp::kReply);
+  arp_hdr->target_hw_addr = arp_hdr->sender_hw_addr;
+  arp_hdr->target_ip_addr = arp_hdr->sender_ip_addr;
+  arp_hdr->sender_hw_addr = CONFIG.nic.ports[port].mac_address;
+  arp_hdr->sender_ip_addr = ip;
+
+  eth_hdr->dst_addr = arp_hdr->target_hw_addr;
+
+  W_DVLOG(2) << "answering arp of: " << ToIpv4Address(ip)
+             << " vlan: " << ToVlan(vlan) << " to: " << arp_hdr->target_hw_addr;
+
+  Handle<EtherOut, Neighbor>(ctx, packet);
 }
 
 }  // namespace xlb::modules
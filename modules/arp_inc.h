@@ -5,22 +5,53 @@
 
 namespace xlb::modules {
 
+// Requests for local ips on their ports and vlans and for vips in their vlans
+// are answered by slaves, the rest goes to kni. Neighbors talking to xlb are
+// learned by the slave receiving them, and shared with the others by the
+// trivial.
 class ArpInc : public Module {
  public:
-  ArpInc()
-      : gw_ip_addr_(Singleton<be32_t, ArpInc>::instance()),
-        gw_hw_addr_(Singleton<Ethernet::Address>::instance()) {
-    ParseIpv4Address(CONFIG.kni.gateway, &gw_ip_addr_);
+  ArpInc();
 
-    // TODO: broadcast when start
-  }
+  void InitInTrivial() override;
 
   template <typename Tag = NoneTag>
   inline void Process(Context *ctx, Packet *packet);
 
  private:
-  be32_t &gw_ip_addr_;
-  Ethernet::Address &gw_hw_addr_;
+  struct alignas(8) Learned {
+    uint16_t port;
+    uint32_t vlan;
+    be32_t ip;
+    Ethernet::Address hw_addr;
+  };
+
+  using Ring = utils::LockLessQueue<Learned *, false, false>;
+
+  // Learned addresses beyond these are dropped, so that a storm of arp can
+  // neither block slaves nor flood them with updates
+  static constexpr size_t kMaxLearned = 1024;
+  static constexpr size_t kMaxSharedPerSec = 256;
+  static constexpr size_t kMaxShared = 4096;
+
+  bool owned(uint16_t port, uint32_t vlan, const be32_t &ip);
+
+  void learn(uint16_t port, uint32_t vlan, const Arp *arp_hdr);
+
+  // Called in the trivial, only changed addresses are sent to slaves
+  size_t share();
+
+  be32_t kni_ip_addr_;
+
+  // Slots of learned addresses are allocated once and passed around by them
+  std::vector<Learned> slots_;
+  Ring free_;
+  Ring learned_;
+
+  // Only used by the trivial
+  std::unordered_map<uint64_t, Ethernet::Address> shared_;
+  size_t budget_;
+  uint64_t budget_tsc_;
 };
 
 }  // namespace xlb::modules
@@ -14,8 +14,11 @@
 
 #include "headers/arp.h"
 #include "headers/ether.h"
+#include "headers/icmp.h"
 #include "headers/ip.h"
+#include "headers/ipv6.h"
 #include "headers/tcp.h"
+#include "headers/udp.h"
 
 #include "ports/kni.h"
 #include "ports/pmd.h"
@@ -44,10 +47,18 @@ using ports::PMD;
 
 using headers::Arp;
 using headers::Ethernet;
+using headers::Icmp;
 using headers::Ipv4;
+using headers::Ipv6;
 using headers::Tcp;
+using headers::Udp;
 
+using headers::InnerVid;
+using headers::is_ipv4_v;
+using headers::OuterVid;
 using headers::ParseIpv4Address;
+using headers::ToIpAddress;
 using headers::ToIpv4Address;
+using headers::ToVlan;
 
 }  // namespace xlb::modules
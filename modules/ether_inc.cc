@@ -1,7 +1,114 @@
 #include "modules/ether_inc.h"
 
+#include "utils/checksum.h"
+
 namespace xlb::modules {
 
+using headers::Vlan;
+
+using utils::CalculateIpv6PseudoSum;
+using utils::CalculatePseudoSum;
+using utils::CalculateSum;
+using utils::FoldChecksum;
+
+namespace {
+
+// Keep the ids of tags in packets as the nic would do, and remove the tags it
+// left. The outer one is stripped first by nics without QinQ.
+void strip_vlan(PacketBatch *batch) {
+  for (Packet &p : *batch) {
+    // The fields are only valid if the nic stripped the tags
+    if (!(p.ol_flags() & PKT_RX_VLAN_STRIPPED))
+      p.set_vlan(0);
+    else if (!(p.ol_flags() & PKT_RX_QINQ_STRIPPED))
+      p.set_vlan(InnerVid(p.vlan()));
+
+    bool stripped = false;
+
+    for (;;) {
+      auto *eth = p.head_data<Ethernet *>();
+
+      if ((eth->ether_type != be16_t(Ethernet::kVlan) &&
+           eth->ether_type != be16_t(Ethernet::kQinQ)) ||
+          unlikely(p.head_len() < int(sizeof(Ethernet) + sizeof(Vlan))))
+        break;
+
+      // More than two tags are left to be dropped as unknown
+      uint32_t vlan = p.vlan();
+      if (unlikely(OuterVid(vlan) != 0)) break;
+
+      auto *tag = reinterpret_cast<Vlan *>(eth + 1);
+      p.set_vlan((uint32_t(InnerVid(vlan)) << 16) |
+                 (tag->tci.value() & Vlan::kVidMask));
+
+      memmove(reinterpret_cast<char *>(eth) + sizeof(Vlan), eth,
+              offsetof(Ethernet, ether_type));
+      p.adj(sizeof(Vlan));
+      stripped = true;
+    }
+
+    if (stripped)
+      p.set_packet_type((p.packet_type() & ~RTE_PTYPE_L2_MASK) |
+                        RTE_PTYPE_L2_ETHER);
+  }
+}
+
+// Ipv6 has no header checksum, only tcp without extension headers is
+// validated
+void verify_ipv6_cksum(Packet *p) {
+  auto *ip = p->head_data<Ipv6 *>(sizeof(Ethernet));
+  int len = p->head_len() - int(sizeof(Ethernet) + sizeof(Ipv6));
+
+  if (unlikely(len < 0 || ip->payload_length.value() > len) ||
+      ip->next_header != Ipv6::kTcp)
+    return;
+
+  len = ip->payload_length.value();
+  uint32_t sum = CalculateIpv6PseudoSum(&ip->src, &ip->dst, Ipv6::kTcp, len);
+  sum += CalculateSum(ip + 1, len);
+  p->set_rx_l4_cksum(FoldChecksum(sum) == 0xffff);
+}
+
+// Validate the checksums of a burst and mark the results in the offload flags
+// as the nic would do, so that the rest of the path knows nothing about it
+void verify_cksum(PacketBatch *batch) {
+  for (Packet &p : *batch) {
+    auto type = p.head_data<Ethernet *>()->ether_type;
+
+    if (type == be16_t(Ethernet::kIpv6)) {
+      verify_ipv6_cksum(&p);
+      continue;
+    }
+
+    if (type != be16_t(Ethernet::kIpv4)) continue;
+
+    auto *ip = p.head_data<Ipv4 *>(sizeof(Ethernet));
+    int ihl = ip->header_length * 4;
+    int len = ip->length.value();
+
+    if (unlikely(p.head_len() < int(sizeof(Ethernet) + sizeof(Ipv4)) ||
+                 ihl < int(sizeof(Ipv4)) || len < ihl ||
+                 len > p.head_len() - int(sizeof(Ethernet)))) {
+      p.set_rx_ip_cksum(false);
+      continue;
+    }
+
+    p.set_rx_ip_cksum(CalculateSum(ip, ihl) == 0xffff);
+
+    // Fragments are not validated just like most nics do
+    if ((ip->protocol != Ipv4::kTcp && ip->protocol != Ipv4::kUdp) ||
+        ip->mf || ip->fragment_offset & be16_t(Ipv4::kOffsetMask))
+      continue;
+
+    uint32_t sum = CalculatePseudoSum(ip->src.raw_value(), ip->dst.raw_value(),
+                                      ip->protocol, len - ihl);
+    sum += CalculateSum(reinterpret_cast<char *>(ip) + ihl, len - ihl);
+    p.set_rx_l4_cksum(FoldChecksum(sum) == 0xffff);
+  }
+}
+
+}  // namespace
+
 void EtherInc::InitInSlave(uint16_t wid) {
   RegisterTask<TS("kni_recv")>([this](Context *ctx) -> Result {
     PacketBatch batch;
@@ -22,12 +129,41 @@ void EtherInc::Process<KNI>(Context *ctx, PacketBatch *batch) {
 
 template <>
 void EtherInc::Process<PMD>(Context *ctx, PacketBatch *batch) {
+  strip_vlan(batch);
+  if (unlikely(!rx_cksum_offload_)) verify_cksum(batch);
+
   for (Packet &p : *batch) {
+    auto ptype = p.packet_type();
+
+    // Dispatch by the classification of nic, parse in software if unknown
+    if (likely(rx_ptype_ &&
+               (ptype & RTE_PTYPE_L2_MASK) == RTE_PTYPE_L2_ETHER &&
+               RTE_ETH_IS_IPV4_HDR(ptype))) {
+      p.set_l2_len(sizeof(Ethernet));
+      Handle<Ipv4Inc, PMD>(ctx, &p);
+      continue;
+    }
+
+    if (rx_ptype_ && (ptype & RTE_PTYPE_L2_MASK) == RTE_PTYPE_L2_ETHER &&
+        RTE_ETH_IS_IPV6_HDR(ptype)) {
+      p.set_l2_len(sizeof(Ethernet));
+      Handle<Ipv6Inc, PMD>(ctx, &p);
+      continue;
+    }
+
+    if (rx_ptype_ && (ptype & RTE_PTYPE_L2_MASK) == RTE_PTYPE_L2_ETHER_ARP) {
+      Handle<ArpInc, PMD>(ctx, &p);
+      continue;
+    }
+
     auto &type = p.head_data<Ethernet *>()->ether_type;
 
     if (likely(type == be16_t(Ethernet::kIpv4))) {
       p.set_l2_len(sizeof(Ethernet));
       Handle<Ipv4Inc, PMD>(ctx, &p);
+    } else if (type == be16_t(Ethernet::kIpv6)) {
+      p.set_l2_len(sizeof(Ethernet));
+      Handle<Ipv6Inc, PMD>(ctx, &p);
     } else if (type == be16_t(Ethernet::kArp)) {
       Handle<ArpInc, PMD>(ctx, &p);
     } else {
@@ -4,12 +4,16 @@
 #include "modules/common.h"
 #include "modules/ether_out.h"
 #include "modules/ipv4_inc.h"
+#include "modules/ipv6_inc.h"
 
 namespace xlb::modules {
 
 class EtherInc final : public Module {
  public:
-  EtherInc() : kni_ring_(CONFIG.kni.ring_size) {
+  EtherInc()
+      : kni_ring_(CONFIG.kni.ring_size),
+        rx_cksum_offload_(CONFIG.nic.rx_cksum_offload),
+        rx_ptype_(CONFIG.nic.rx_ptype) {
     F_DLOG(INFO) << "init with weight: "
                  << " ring size: " << kni_ring_.Capacity();
   }
@@ -23,6 +27,11 @@ class EtherInc final : public Module {
   // For sending packets received from kni to pmd (in slave)
   static constexpr uint8_t kWeight = 10;
   utils::LockLessQueue<Packet *, true, false> kni_ring_;
+
+  // Done in software for the whole burst if the nic is not capable
+  bool rx_cksum_offload_;
+  // Otherwise the ether type of each packet is parsed
+  bool rx_ptype_;
 };
 
 }  // namespace xlb::modules
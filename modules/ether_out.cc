@@ -2,6 +2,45 @@
 
 namespace xlb::modules {
 
+using headers::Vlan;
+
+bool InsertVlan(Packet *packet) {
+  uint32_t vlan = packet->vlan();
+  if (vlan == 0) return true;
+
+  bool qinq = OuterVid(vlan) != 0;
+
+  if (qinq ? CONFIG.nic.tx_qinq_insert : CONFIG.nic.tx_vlan_insert) {
+    packet->set_ol_flags(qinq ? PKT_TX_QINQ_PKT : PKT_TX_VLAN_PKT);
+    return true;
+  }
+
+  // Both tags are inserted in software if the nic is only capable of one
+  size_t len = qinq ? sizeof(Vlan) * 2 : sizeof(Vlan);
+  auto *data = packet->prepend(len);
+  if (unlikely(!data)) return false;
+
+  auto *hdr = reinterpret_cast<Ethernet *>(data);
+  memmove(hdr, reinterpret_cast<char *>(hdr) + len,
+          offsetof(Ethernet, ether_type));
+
+  // The original ether type is already behind the last tag
+  auto *tag = reinterpret_cast<Vlan *>(hdr + 1);
+  if (qinq) {
+    hdr->ether_type = be16_t(Ethernet::kQinQ);
+    tag->tci = be16_t(OuterVid(vlan));
+    tag->ether_type = be16_t(Ethernet::kVlan);
+    ++tag;
+  } else {
+    hdr->ether_type = be16_t(Ethernet::kVlan);
+  }
+  tag->tci = be16_t(InnerVid(vlan));
+
+  // Checksums offloaded by nic are located by the length of l2
+  packet->set_l2_len(packet->l2_len() + len);
+  return true;
+}
+
 void EtherOut::InitInMaster() {
   RegisterTask<TS("kni_send")>([this](Context *ctx) -> Result {
     PacketBatch batch;
@@ -14,8 +53,21 @@ void EtherOut::InitInMaster() {
   });
 }
 
+void EtherOut::InitInSlave(uint16_t wid) {
+  utils::UnsafeSingletonTLS<Neighbors>::Init();
+
+  RegisterTask<TS("neighbors_sweep")>(
+      [](Context *) -> Result { return {.packets = NEIGHBORS.Sweep()}; });
+}
+
 template <>
 void EtherOut::Process<KNI>(Context *ctx, Packet *packet) {
+  // Kni is bound to the first port and untagged
+  if (packet->port() != 0 || packet->vlan() != 0) {
+    ctx->Drop(packet);
+    return;
+  }
+
   while (!kni_ring_.Push(packet))
     W_LOG(ERROR) << "too many packets are on the way to kernel";
 }
@@ -24,10 +76,67 @@ template <>
 void EtherOut::Process<PMD>(Context *ctx, Packet *packet) {
   auto *hdr = packet->head_data<Ethernet *>();
 
-  hdr->src_addr = CONFIG.nic.mac_address;
+  uint16_t port;
+  uint32_t vlan;
+  const Ethernet::Address *hw_addr;
+
+  if (hdr->ether_type == be16_t(Ethernet::kIpv4)) {
+    auto *ip = reinterpret_cast<Ipv4 *>(hdr + 1);
+    // Paths are picked by addresses, so that a flow sticks to one of them
+    size_t hash = hash_combine(std::hash<be32_t>{}(ip->src),
+                               std::hash<be32_t>{}(ip->dst));
+    be32_t hop;
+
+    if (unlikely(!ROUTES.Lookup(ip->dst, hash, &hop, &port, &vlan))) {
+      ctx->Drop(packet);
+      W_DVLOG(1) << "no route to: " << ToIpv4Address(ip->dst);
+      return;
+    }
+
+    if (unlikely(!(hw_addr = NEIGHBORS.Resolve(ctx, port, vlan, hop)))) {
+      ctx->Drop(packet);
+      W_DVLOG(1) << "unresolved neighbor: " << ToIpv4Address(hop);
+      return;
+    }
+  } else {
+    // Ipv6 only goes through the configured gateway, without which ipv6
+    // services are not accepted
+    if (unlikely(CONFIG.route.ipv6_gateway.empty())) {
+      ctx->Drop(packet);
+      W_DVLOG(1) << "no ipv6 gateway";
+      return;
+    }
+
+    port = CONFIG.route.ipv6_gateway_port;
+    vlan = CONFIG.route.ipv6_gateway_vlan;
+    hw_addr = &CONFIG.route.ipv6_gateway_addr;
+  }
+
+  hdr->src_addr = CONFIG.nic.ports[port].mac_address;
+  hdr->dst_addr = *hw_addr;
+
+  packet->set_port(port);
+  packet->set_vlan(vlan);
+  if (unlikely(!InsertVlan(packet))) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "no headroom for vlan";
+    return;
+  }
+
+  ctx->Hold(packet);
+}
+
+template <>
+void EtherOut::Process<Neighbor>(Context *ctx, Packet *packet) {
+  auto *hdr = packet->head_data<Ethernet *>();
+
+  hdr->src_addr = CONFIG.nic.ports[packet->port()].mac_address;
 
-  //  asm volatile("" : "=m"(const_cast<Ethernet::Address &>(gw_hw_addr_)) : :);
-  hdr->dst_addr = gw_hw_addr_;
+  if (unlikely(!InsertVlan(packet))) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "no headroom for vlan";
+    return;
+  }
 
   ctx->Hold(packet);
 }
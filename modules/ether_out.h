@@ -2,18 +2,28 @@
 
 #include "modules/common.h"
 #include "modules/port_out.h"
+#include "modules/route.h"
 
 namespace xlb::modules {
 
+// Tag of packets to a neighbor on the local segment rather than the gateway,
+// whose mac, port and vlan have been set
+struct Neighbor {};
+
+// Tag 'packet' with its vlan by the nic if capable, otherwise in software,
+// return false if there is no headroom
+bool InsertVlan(Packet *packet);
+
 class EtherOut : public Module {
  public:
-  EtherOut()
-      : gw_hw_addr_(Singleton<Ethernet::Address>::instance()),
-        kni_ring_(CONFIG.kni.ring_size) {
-    F_LOG(INFO) << "source mac address: " << CONFIG.nic.mac_address.ToString();
+  EtherOut() : kni_ring_(CONFIG.kni.ring_size) {
+    for (auto &port : CONFIG.nic.ports)
+      F_LOG(INFO) << "source mac address: " << port.mac_address.ToString();
+    utils::UnsafeSingleton<Routes>::Init();
   }
 
   void InitInMaster() override;
+  void InitInSlave(uint16_t wid) override;
 
   template <typename Tag = NoneTag>
   inline void Process(Context *ctx, Packet *packet);
@@ -27,7 +37,6 @@ class EtherOut : public Module {
 
   //  uint8_t weight_;
   //  const Ethernet::Address &src_hw_addr_;
-  const Ethernet::Address &gw_hw_addr_;
   utils::LockLessQueue<Packet *, false, true> kni_ring_;
 };
 
@@ -0,0 +1,248 @@
+#include "modules/icmp_inc.h"
+#include "modules/ether_out.h"
+
+#include "conntrack/conn.h"
+#include "conntrack/table.h"
+
+#include "utils/checksum.h"
+
+namespace xlb::modules {
+
+using conntrack::Conn;
+using conntrack::Forward;
+using conntrack::Tuple2;
+using conntrack::Tuple4;
+
+using conntrack::ip_conntrack_dir::IP_CT_DIR_ORIGINAL;
+
+using utils::CalculateSum;
+using utils::ChecksumIncrement16;
+using utils::ChecksumIncrement32;
+using utils::UpdateChecksum16;
+using utils::UpdateChecksumWithIncrement;
+
+namespace {
+
+void rewrite_outer(Ipv4 *ip, const be32_t &src, const be32_t &dst) {
+  uint32_t incr = ChecksumIncrement32(ip->src.raw_value(), src.raw_value()) +
+                  ChecksumIncrement32(ip->dst.raw_value(), dst.raw_value());
+
+  ip->checksum = UpdateChecksumWithIncrement(ip->checksum, incr);
+  ip->src = src;
+  ip->dst = dst;
+}
+
+}  // namespace
+
+void rewrite_inner(Ipv4 *ip, Tcp *tcp, size_t l4_len, const Tuple2 &src,
+                   const Tuple2 &dst) {
+  uint32_t ip_incr =
+      ChecksumIncrement32(ip->src.raw_value(), src.ip.raw_value()) +
+      ChecksumIncrement32(ip->dst.raw_value(), dst.ip.raw_value());
+
+  if (l4_len >= offsetof(Tcp, checksum) + sizeof(tcp->checksum)) {
+    uint32_t tcp_incr =
+        ip_incr +
+        ChecksumIncrement16(tcp->src_port.raw_value(), src.port.raw_value()) +
+        ChecksumIncrement16(tcp->dst_port.raw_value(), dst.port.raw_value());
+
+    tcp->checksum = UpdateChecksumWithIncrement(tcp->checksum, tcp_incr);
+  }
+
+  ip->checksum = UpdateChecksumWithIncrement(ip->checksum, ip_incr);
+  ip->src = src.ip;
+  ip->dst = dst.ip;
+  tcp->src_port = src.port;
+  tcp->dst_port = dst.port;
+}
+
+IcmpInc::IcmpInc() : budgets_(CONFIG.slave_cores.size()) {
+  for (size_t i = 0; i < CONFIG.slave_cores.size(); ++i)
+    rings_.emplace_back(std::make_unique<Ring>());
+}
+
+void IcmpInc::InitInSlave(uint16_t wid) {
+  if (CONFIG.icmp.rate == 0) return;
+
+  budgets_[wid] = {CONFIG.icmp.rate, W_TSC + tsc_sec};
+
+  RegisterTask<TS("icmp_recv")>([this, wid](Context *ctx) -> Result {
+    PacketBatch batch;
+
+    batch.SetCnt(rings_[wid]->Pop(batch.pkts(), Packet::kMaxBurst));
+
+    for (Packet &packet : batch)
+      if (!translate(ctx, &packet)) ctx->Drop(&packet);
+
+    return {.packets = batch.cnt()};
+  });
+}
+
+bool IcmpInc::allowed(uint16_t wid) {
+  auto &budget = budgets_[wid];
+
+  if (W_TSC >= budget.until) {
+    budget.left = CONFIG.icmp.rate;
+    budget.until = W_TSC + tsc_sec;
+  }
+
+  if (budget.left == 0) return false;
+
+  --budget.left;
+  return true;
+}
+
+bool IcmpInc::translate(Context *ctx, Packet *packet) {
+  auto *ip_hdr = packet->head_data<Ipv4 *>(packet->l2_len());
+  auto *icmp_hdr = packet->head_data<Icmp *>(packet->l2_len() +
+                                             packet->l3_len());
+  int icmp_len = ip_hdr->length.value() - int(packet->l3_len());
+
+  auto *inner_ip = reinterpret_cast<Ipv4 *>(icmp_hdr + 1);
+  int inner_l3_len = inner_ip->header_length * 4;
+  auto *inner_tcp = reinterpret_cast<Tcp *>(
+      reinterpret_cast<uint8_t *>(inner_ip) + inner_l3_len);
+  int inner_l4_len = icmp_len - int(sizeof(Icmp)) - inner_l3_len;
+
+  // Errors must carry at least 8 bytes of the packet for the ports
+  if (unlikely(inner_l3_len < int(sizeof(Ipv4)) || inner_l4_len < 8 ||
+               inner_ip->protocol != Ipv4::kTcp)) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "invalid icmp error";
+    return true;
+  }
+
+  // The embedded packet was sent by xlb, so its connection is found by the
+  // tuple reversed
+  Tuple4 tuple{{inner_ip->dst, inner_tcp->dst_port},
+               {inner_ip->src, inner_tcp->src_port}};
+
+  Conn *conn = CTABLE.Find(tuple);
+  if (!conn) return false;
+
+  // Replies of other modes do not pass through xlb
+  if (conn->forward() != Forward::kFullNat) {
+    ctx->Drop(packet);
+    return true;
+  }
+
+  auto &real = conn->real();
+  auto &virt = conn->virt();
+
+  if (conn->direction(tuple) == IP_CT_DIR_ORIGINAL) {
+    // About a packet to the client, which was sent by rs
+    rewrite_inner(inner_ip, inner_tcp, inner_l4_len, real->tuple(),
+                  conn->local());
+    rewrite_outer(ip_hdr, conn->local().ip, real->tuple().ip);
+  } else {
+    // About a packet to rs, which was sent by the client
+    rewrite_inner(inner_ip, inner_tcp, inner_l4_len, conn->client(),
+                  virt->tuple());
+    rewrite_outer(ip_hdr, virt->tuple().ip, conn->client().ip);
+  }
+
+  // Errors are rare, so the checksum of the whole message is calculated again
+  icmp_hdr->checksum = 0;
+  icmp_hdr->checksum = ~CalculateSum(icmp_hdr, icmp_len);
+
+  W_DVLOG(2) << "icmp error translated, type: " << unsigned{icmp_hdr->type}
+             << " code: " << unsigned{icmp_hdr->code} << " conn: " << *conn;
+
+  Handle<EtherOut, PMD>(ctx, packet);
+  return true;
+}
+
+void IcmpInc::echo(Context *ctx, Packet *packet) {
+  auto *eth_hdr = packet->head_data<Ethernet *>();
+  auto *ip_hdr = packet->head_data<Ipv4 *>(packet->l2_len());
+  auto *icmp_hdr = packet->head_data<Icmp *>(packet->l2_len() +
+                                             packet->l3_len());
+
+  // Swapping addresses keeps the checksum of ip, only ttl changes it
+  be16_t old_ttl((ip_hdr->ttl << 8) | ip_hdr->protocol);
+  be16_t new_ttl((kEchoTtl << 8) | ip_hdr->protocol);
+  ip_hdr->checksum = UpdateChecksum16(ip_hdr->checksum, old_ttl.raw_value(),
+                                      new_ttl.raw_value());
+  ip_hdr->ttl = kEchoTtl;
+
+  be32_t src = ip_hdr->src;
+  ip_hdr->src = ip_hdr->dst;
+  ip_hdr->dst = src;
+
+  be16_t old_type((Icmp::kEchoRequest << 8) | icmp_hdr->code);
+  be16_t new_type((Icmp::kEchoReply << 8) | icmp_hdr->code);
+  icmp_hdr->checksum = UpdateChecksum16(
+      icmp_hdr->checksum, old_type.raw_value(), new_type.raw_value());
+  icmp_hdr->type = Icmp::kEchoReply;
+
+  // Back to where it came from, either the gateway or a neighbor
+  eth_hdr->dst_addr = eth_hdr->src_addr;
+
+  Handle<EtherOut, Neighbor>(ctx, packet);
+}
+
+void IcmpInc::pass(Packet *packet) {
+  for (size_t wid = 0; wid < rings_.size(); ++wid) {
+    if (wid == W_ID) continue;
+
+    Packet *copy = Packet::Copy(packet);
+    if (unlikely(!copy)) break;
+
+    copy->set_l2_len(packet->l2_len());
+    copy->set_l3_len(packet->l3_len());
+
+    if (unlikely(!rings_[wid]->Push(copy))) Packet::Free(copy);
+  }
+}
+
+template <>
+void IcmpInc::Process<PMD>(Context *ctx, Packet *packet) {
+  auto *ip_hdr = packet->head_data<Ipv4 *>(packet->l2_len());
+  auto *icmp_hdr = packet->head_data<Icmp *>(packet->l2_len() +
+                                             packet->l3_len());
+  int icmp_len = ip_hdr->length.value() - int(packet->l3_len());
+
+  bool request = icmp_hdr->type == Icmp::kEchoRequest;
+
+  // Echo is answered for vips, errors are translated, the others are dropped
+  if (request ? !STABLE.IsVip(ip_hdr->dst, packet->vlan())
+              : icmp_hdr->type != Icmp::kDestUnreachable &&
+                    icmp_hdr->type != Icmp::kTimeExceeded &&
+                    icmp_hdr->type != Icmp::kParameterProblem) {
+    ctx->Drop(packet);
+    return;
+  }
+
+  if (unlikely(!allowed(W_ID))) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "too many icmp messages";
+    return;
+  }
+
+  int min_len = sizeof(Icmp) + (request ? 0 : sizeof(Ipv4));
+  if (unlikely(icmp_len < min_len ||
+               packet->head_len() < int(packet->l2_len() +
+                                        ip_hdr->length.value()))) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "truncated icmp message";
+    return;
+  }
+
+  if (unlikely(CalculateSum(icmp_hdr, icmp_len) != 0xffff)) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "invalid icmp checksum";
+    return;
+  }
+
+  if (request) {
+    echo(ctx, packet);
+    return;
+  }
+
+  if (translate(ctx, packet)) return;
+
+  pass(packet);
+  ctx->Drop(packet);
+}
+
+}  // namespace xlb::modules
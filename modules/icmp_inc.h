@@ -0,0 +1,53 @@
+#pragma once
+
+#include "modules/common.h"
+
+#include "conntrack/tuple.h"
+
+namespace xlb::modules {
+
+// Rewrite the packet embedded in an error to be from 'src' to 'dst'. Only the
+// ports of tcp are sure to be there, its checksum is patched if present.
+void rewrite_inner(Ipv4 *ip, Tcp *tcp, size_t l4_len,
+                   const conntrack::Tuple2 &src, const conntrack::Tuple2 &dst);
+
+// Icmp errors of ipv4 about full-nat connections are translated to what the
+// peer sent and forwarded to it, so that pmtu discovery works through xlb.
+// Echo requests to vips are answered here rather than by the kernel.
+class IcmpInc : public Module {
+ public:
+  IcmpInc();
+
+  void InitInSlave(uint16_t wid) override;
+
+  template <typename Tag = NoneTag>
+  inline void Process(Context *ctx, Packet *packet);
+
+ private:
+  using Ring = utils::LockLessQueue<Packet *, false, true>;
+
+  static constexpr uint8_t kEchoTtl = 64;
+
+  // Errors are counted in bulk by the second rather than a token per packet
+  struct alignas(64) Budget {
+    uint64_t left;
+    uint64_t until;
+  };
+
+  bool allowed(uint16_t wid);
+
+  void echo(Context *ctx, Packet *packet);
+
+  // Return false with the packet untouched if the connection is not in this
+  // slave, otherwise the packet is either forwarded or dropped
+  bool translate(Context *ctx, Packet *packet);
+
+  // Errors toward vips land on any slave by rss, so the missed ones are passed
+  // to the other slaves, where the connections may be
+  void pass(Packet *packet);
+
+  std::vector<Budget> budgets_;
+  std::vector<std::unique_ptr<Ring>> rings_;
+};
+
+}  // namespace xlb::modules
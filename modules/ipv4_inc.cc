@@ -18,16 +18,41 @@ void Ipv4Inc::Process<PMD>(Context *ctx, Packet *packet) {
     return;
   }
 
+  // Classified by nic as tcp or udp without options and not fragmented
+  auto ptype = packet->packet_type() & (RTE_PTYPE_L3_MASK | RTE_PTYPE_L4_MASK);
+  if (likely(rx_ptype_ && ptype == (RTE_PTYPE_L3_IPV4 | RTE_PTYPE_L4_TCP))) {
+    packet->set_l3_len(sizeof(Ipv4));
+    Handle<TcpInc, PMD>(ctx, packet);
+    return;
+  }
+
+  if (rx_ptype_ && udp_ && ptype == (RTE_PTYPE_L3_IPV4 | RTE_PTYPE_L4_UDP)) {
+    packet->set_l3_len(sizeof(Ipv4));
+    Handle<UdpInc, PMD>(ctx, packet);
+    return;
+  }
+
   if (unlikely(ipv4_hdr->mf ||
                ipv4_hdr->fragment_offset & be16_t(Ipv4::kOffsetMask))) {
-    ctx->Drop(packet);
-    W_DVLOG(1) << "fragmented ipv4 packet";
+    if (frag_ && ipv4_hdr->protocol == Ipv4::kTcp) {
+      packet->set_l3_len(ipv4_hdr->header_length * 4);
+      Handle<TcpInc, Fragment>(ctx, packet);
+    } else {
+      ctx->Drop(packet);
+      W_DVLOG(1) << "fragmented ipv4 packet";
+    }
     return;
   }
 
   if (likely(ipv4_hdr->protocol == Ipv4::kTcp)) {
     packet->set_l3_len(ipv4_hdr->header_length * 4);
     Handle<TcpInc, PMD>(ctx, packet);
+  } else if (udp_ && ipv4_hdr->protocol == Ipv4::kUdp) {
+    packet->set_l3_len(ipv4_hdr->header_length * 4);
+    Handle<UdpInc, PMD>(ctx, packet);
+  } else if (icmp_ && ipv4_hdr->protocol == Ipv4::kIcmp) {
+    packet->set_l3_len(ipv4_hdr->header_length * 4);
+    Handle<IcmpInc, PMD>(ctx, packet);
   } else {
     ctx->Drop(packet);
   }
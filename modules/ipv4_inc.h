@@ -1,13 +1,20 @@
 #pragma once
 
 #include "modules/common.h"
+#include "modules/icmp_inc.h"
 #include "modules/tcp_inc.h"
+#include "modules/udp_inc.h"
 
 namespace xlb::modules {
 
 class Ipv4Inc : public Module {
  public:
-  Ipv4Inc() : kni_ip_addr_(Singleton<be32_t, Ipv4Inc>::instance()) {
+  Ipv4Inc()
+      : kni_ip_addr_(Singleton<be32_t, Ipv4Inc>::instance()),
+        rx_ptype_(CONFIG.nic.rx_ptype),
+        frag_(CONFIG.frag.max_datagrams > 0),
+        udp_(CONFIG.udp.max_flows > 0),
+        icmp_(CONFIG.icmp.rate > 0) {
     ParseIpv4Address(CONFIG.kni.ip_address, &kni_ip_addr_);
   }
 
@@ -16,6 +23,14 @@ class Ipv4Inc : public Module {
 
  private:
   be32_t &kni_ip_addr_;
+  // Otherwise the header of each packet is parsed
+  bool rx_ptype_;
+  // Otherwise fragments are dropped
+  bool frag_;
+  // Otherwise udp is dropped
+  bool udp_;
+  // Otherwise icmp is dropped
+  bool icmp_;
 };
 
 }  // namespace xlb::modules
@@ -0,0 +1,33 @@
+#include "modules/ipv6_inc.h"
+#include "modules/ether_out.h"
+
+namespace xlb::modules {
+
+template <>
+void Ipv6Inc::Process<PMD>(Context *ctx, Packet *packet) {
+  auto *ipv6_hdr = packet->head_data<Ipv6 *>(packet->l2_len());
+  int len = packet->head_len() - packet->l2_len() - int(sizeof(Ipv6));
+
+  if (unlikely(len < 0 || ipv6_hdr->version() != 6 ||
+               ipv6_hdr->payload_length.value() > len)) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "invalid ipv6 header";
+    return;
+  }
+
+  // Neighbor discovery and the rest of icmpv6 are left to kernel
+  if (unlikely(ipv6_hdr->next_header == Ipv6::kIcmp)) {
+    Handle<EtherOut, KNI>(ctx, packet);
+    return;
+  }
+
+  // Extension headers (including fragments) are not followed
+  if (likely(enabled_ && ipv6_hdr->next_header == Ipv6::kTcp)) {
+    packet->set_l3_len(sizeof(Ipv6));
+    Handle<TcpInc, Inet6>(ctx, packet);
+  } else {
+    ctx->Drop(packet);
+  }
+}
+
+}  // namespace xlb::modules
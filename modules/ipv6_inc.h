@@ -0,0 +1,20 @@
+#pragma once
+
+#include "modules/common.h"
+#include "modules/tcp_inc.h"
+
+namespace xlb::modules {
+
+class Ipv6Inc : public Module {
+ public:
+  Ipv6Inc() : enabled_(CONFIG.svc.max_ipv6_conn > 0) {}
+
+  template <typename Tag = NoneTag>
+  inline void Process(Context *ctx, Packet *packet);
+
+ private:
+  // Otherwise only icmpv6 is passed to kni
+  bool enabled_;
+};
+
+}  // namespace xlb::modules
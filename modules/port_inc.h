@@ -10,38 +10,55 @@ class PortInc final : public Module {
   static_assert(std::is_base_of<Port, T>::value);
 
  public:
-  explicit PortInc() : port_(Singleton<T>::instance()) {}
+  explicit PortInc() {
+    if constexpr (is_same<T, PMD>::value)
+      for (auto &port : PMD::All()) ports_.emplace_back(port.get());
+    else
+      ports_.emplace_back(&Singleton<T>::instance());
+  }
 
   void InitInMaster() override {
     if constexpr (!Master) return;
-    register_task();
+    register_task(0, 0);
   }
 
   void InitInSlave(uint16_t wid) override {
     if constexpr (Master) return;
-    register_task();
+
+    // Each slave polls the rx queues of its turn on the ports of its socket
+    if constexpr (is_same<T, PMD>::value)
+      for (uint16_t i = 0; i < ports_.size(); ++i)
+        for (uint16_t qid = 0; qid < ports_[i]->rx_queues(); ++qid)
+          if (ports_[i]->slave_of(qid) == wid) register_task(i, qid);
+    else
+      register_task(0, wid);
   }
 
   //  ~PortInc() { delete (port_); }
 
  protected:
-  void register_task() {
-    RegisterTask<TS("pmd_recv")>([this](Context *ctx) -> Result {
-      PacketBatch batch;
+  // Each queue is polled by a task of its own, named by the port and the queue
+  void register_task(uint16_t index, uint16_t qid) {
+    T *port = ports_[index];
+
+    RegisterTask<TS("pmd_recv")>(
+        [this, port, qid](Context *ctx) -> Result {
+          PacketBatch batch;
 
-      batch.SetCnt(port_.Recv(W_ID, batch.pkts(), Packet::kMaxBurst));
+          batch.SetCnt(port->Recv(qid, batch.pkts(), Packet::kMaxBurst));
 
-      if (!batch.Empty()) Handle<EtherInc, T>(ctx, &batch);
+          if (!batch.Empty()) Handle<EtherInc, T>(ctx, &batch);
 
-      return {.packets = batch.cnt()};
-    });
+          return {.packets = batch.cnt()};
+        },
+        utils::Format("%hu_%hu", index, qid), true);
   }
 
  private:
   static constexpr uint8_t kWeight = 200;
 
   uint8_t weight_;
-  T &port_;
+  std::vector<T *> ports_;
 };
 
 }  // namespace xlb::modules
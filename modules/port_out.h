@@ -9,13 +9,32 @@ class PortOut final : public Module {
   static_assert(std::is_base_of<Port, T>::value);
 
  public:
-  explicit PortOut() : port_(Singleton<T>::instance()) {}
+  explicit PortOut() {
+    if constexpr (is_same<T, PMD>::value)
+      for (auto &port : PMD::All()) ports_.emplace_back(port.get());
+    else
+      ports_.emplace_back(&Singleton<T>::instance());
+  }
 
   //  ~PortOut() { delete (port_); }
 
+  // Packets are sent to the ports in their metadata
   template <typename Tag = NoneTag>
   void Process(Context *ctx, PacketBatch *batch) {
-    port_.Send(W_ID, batch->pkts(), batch->cnt());
+    if (likely(ports_.size() == 1)) {
+      ports_.front()->Send(W_ID, batch->pkts(), batch->cnt());
+      return;
+    }
+
+    for (uint16_t i = 0; i < ports_.size(); ++i) {
+      PacketBatch out;
+      out.Clear();
+
+      for (Packet &p : *batch)
+        if (p.port() == i) out.Push(&p);
+
+      if (!out.Empty()) ports_[i]->Send(W_ID, out.pkts(), out.cnt());
+    }
   }
 
   //  template <typename Tag = NoneTag>
@@ -24,7 +43,8 @@ class PortOut final : public Module {
   //  }
 
  private:
-  T &port_;
+  // Indexed by the port in metadata
+  std::vector<T *> ports_;
 };
 
 }  // namespace xlb::modules
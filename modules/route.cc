@@ -0,0 +1,256 @@
+#include "modules/route.h"
+#include "modules/ether_out.h"
+
+namespace xlb::modules {
+
+Routes::Routes() : groups_(CONFIG.route.max_routes), graces_(0) {
+  rte_lpm_config conf = {.max_rules = uint32_t(CONFIG.route.max_routes),
+                         .number_tbl8s = kTbl8s,
+                         .flags = 0};
+
+  lpm_ = rte_lpm_create("Routes", CONFIG.nic.socket, &conf);
+  CHECK_NOTNULL(lpm_);
+
+  for (uint32_t i = 0; i < groups_.size(); ++i) free_groups_.push_back(i);
+
+  be32_t ip, netmask, gateway;
+  CHECK(ParseIpv4Address(CONFIG.kni.ip_address, &ip));
+  CHECK(ParseIpv4Address(CONFIG.kni.netmask, &netmask));
+  CHECK(ParseIpv4Address(CONFIG.kni.gateway, &gateway));
+
+  // The segment of kni and the default route through its gateway
+  CHECK(Add(ip & netmask, __builtin_popcount(netmask.value()), {be32_t(0)}));
+  CHECK(Add(be32_t(0), 0, {gateway}));
+}
+
+Routes::~Routes() { rte_lpm_free(lpm_); }
+
+bool Routes::Add(const be32_t &prefix, uint8_t depth,
+                 const std::vector<be32_t> &gateways, uint16_t port,
+                 uint32_t vlan) {
+  DCHECK(!gateways.empty() && gateways.size() <= kMaxPaths);
+  DCHECK_LE(depth, 32);
+
+  auto key = std::make_pair(prefix.value() & Mask(depth), depth);
+  auto it = rules_.find(key);
+
+  if (free_groups_.empty()) return false;
+
+  uint32_t id = free_groups_.front();
+  Group &group = groups_[id];
+
+  std::copy(gateways.begin(), gateways.end(), group.gateways);
+  group.size = gateways.size();
+  group.port = port;
+  group.vlan = vlan;
+
+  // The group must be complete before it is visible to slaves
+  std::atomic_thread_fence(std::memory_order_release);
+
+  if (rte_lpm_add(lpm_, key.first, depth, id) != 0) return false;
+
+  free_groups_.pop_front();
+
+  if (it != rules_.end()) {
+    retire(it->second);
+    it->second = id;
+  } else {
+    rules_.emplace(key, id);
+  }
+
+  return true;
+}
+
+bool Routes::Remove(const be32_t &prefix, uint8_t depth) {
+  auto key = std::make_pair(prefix.value() & Mask(depth), depth);
+  auto it = rules_.find(key);
+
+  if (it == rules_.end()) return false;
+
+  CHECK_EQ(rte_lpm_delete(lpm_, key.first, depth), 0);
+
+  retire(it->second);
+  rules_.erase(it);
+
+  return true;
+}
+
+void Routes::AfterGrace(std::function<void()> &&func) {
+  if (graces_ == 0)
+    func();
+  else
+    waiting_.emplace_back(std::move(func));
+}
+
+void Routes::retire(uint32_t id) {
+  auto pending =
+      std::make_shared<std::atomic<size_t>>(CONFIG.slave_cores.size());
+
+  ++graces_;
+
+  // A slave never looks up in the middle of syncing, parked ones included
+  Exec::InSlaves([id, pending]() {
+    if (pending->fetch_sub(1) != 1) return;
+
+    Exec::InTrivial([id]() {
+      auto &routes = ROUTES;
+
+      routes.free_groups_.push_back(id);
+      if (--routes.graces_ > 0) return;
+
+      auto waiting = std::move(routes.waiting_);
+      routes.waiting_.clear();
+      for (auto &func : waiting) func();
+    });
+  });
+}
+
+Neighbors::Neighbors()
+    : entries_(CONFIG.route.max_neighbors, ALLOC),
+      idx_map_(CONFIG.route.max_neighbors),
+      idx_pool_(utils::make_vector<uint32_t>(CONFIG.route.max_neighbors)),
+      cursor_(0) {
+  CHECK(ParseIpv4Address(CONFIG.kni.ip_address,
+                          &src_ip_addrs_[key(0, 0, be32_t(0))]));
+
+  for (auto &pair : CONFIG.local_ip_links)
+    src_ip_addrs_.emplace(key(pair.second.port, pair.second.vlan, be32_t(0)),
+                          pair.first);
+
+  for (uint32_t idx = 0; idx < entries_.size(); ++idx) idx_pool_.push(idx);
+}
+
+const Ethernet::Address *Neighbors::Resolve(Context *ctx, uint16_t port,
+                                            uint32_t vlan, const be32_t &ip) {
+  uint64_t k = key(port, vlan, ip);
+  auto *found = idx_map_.Find(k);
+  Entry *entry;
+
+  if (found) {
+    entry = &entries_[found->value];
+  } else {
+    if (unlikely(idx_pool_.empty() || !idx_map_.Emplace(k, idx_pool_.top()))) {
+      W_DVLOG(1) << "too many neighbors to resolve: " << ToIpv4Address(ip);
+      return nullptr;
+    }
+
+    entry = &entries_[idx_pool_.top()];
+    idx_pool_.pop();
+
+    *entry = Entry{};
+    entry->key = k;
+    entry->used = true;
+    entry->since_tsc = W_TSC;
+  }
+
+  entry->last_tsc = W_TSC;
+
+  if (entry->resolved && W_TSC >= entry->expire_tsc) {
+    entry->resolved = false;
+    entry->since_tsc = W_TSC;
+    W_LOG(INFO) << "neighbor expired: " << ToIpv4Address(ip)
+                << " port: " << port << " vlan: " << ToVlan(vlan);
+  }
+
+  // Refreshed before it expires, so that the traffic is not interrupted
+  if ((!entry->resolved || W_TSC >= entry->refresh_tsc) &&
+      W_TSC >= entry->probe_tsc) {
+    probe(ctx, port, vlan, ip);
+    entry->probe_tsc = W_TSC + CONFIG.route.probe_interval * utils::tsc_ms;
+  }
+
+  return entry->resolved ? &entry->hw_addr : nullptr;
+}
+
+void Neighbors::Update(uint16_t port, uint32_t vlan, const be32_t &ip,
+                       const Ethernet::Address &hw_addr) {
+  auto *found = idx_map_.Find(key(port, vlan, ip));
+  if (!found) return;
+
+  Entry &entry = entries_[found->value];
+
+  if (!entry.resolved || entry.hw_addr != hw_addr)
+    W_LOG(INFO) << "neighbor: " << ToIpv4Address(ip) << " port: " << port
+                << " vlan: " << ToVlan(vlan) << " at: " << hw_addr;
+
+  uint64_t timeout = CONFIG.route.neighbor_timeout * tsc_sec;
+
+  entry.hw_addr = hw_addr;
+  entry.resolved = true;
+  entry.refresh_tsc = W_TSC + timeout / 2;
+  entry.expire_tsc = W_TSC + timeout;
+  entry.probe_tsc = 0;
+}
+
+size_t Neighbors::Sweep() {
+  uint64_t idle = CONFIG.route.neighbor_timeout * tsc_sec;
+  uint64_t unresolved =
+      kMaxProbes * CONFIG.route.probe_interval * utils::tsc_ms;
+  size_t evicted = 0;
+
+  for (size_t i = 0; i < kSweepBatch; ++i) {
+    Entry &entry = entries_[cursor_];
+    uint32_t idx = cursor_;
+
+    cursor_ = (cursor_ + 1) % entries_.size();
+
+    if (!entry.used) continue;
+
+    if (W_TSC - entry.last_tsc < idle &&
+        (entry.resolved || W_TSC - entry.since_tsc < unresolved))
+      continue;
+
+    idx_map_.Remove(entry.key);
+    idx_pool_.push(idx);
+    entry.used = false;
+    ++evicted;
+  }
+
+  return evicted;
+}
+
+void Neighbors::probe(Context *ctx, uint16_t port, uint32_t vlan,
+                      const be32_t &ip) {
+  auto src = src_ip_addrs_.find(key(port, vlan, be32_t(0)));
+  if (unlikely(src == src_ip_addrs_.end())) {
+    W_DVLOG(1) << "no local ip on port: " << port
+               << " vlan: " << ToVlan(vlan);
+    return;
+  }
+
+  auto *packet = reinterpret_cast<Packet *>(
+      rte_pktmbuf_alloc(W_CURRENT->packet_pool()->pool()));
+  if (unlikely(!packet)) return;
+
+  auto *eth_hdr = reinterpret_cast<Ethernet *>(
+      packet->append(sizeof(Ethernet) + sizeof(Arp)));
+  auto *arp_hdr = reinterpret_cast<Arp *>(eth_hdr + 1);
+
+  memset(eth_hdr->dst_addr.bytes, 0xff, Ethernet::Address::kSize);
+  eth_hdr->src_addr = CONFIG.nic.ports[port].mac_address;
+  eth_hdr->ether_type = be16_t(Ethernet::kArp);
+
+  arp_hdr->hw_addr = be16_t(Arp::kEthernet);
+  arp_hdr->proto_addr = be16_t(Ethernet::kIpv4);
+  arp_hdr->hw_addr_length = Ethernet::Address::kSize;
+  arp_hdr->proto_addr_length = sizeof(be32_t);
+  arp_hdr->opcode = be16_t(Arp::kRequest);
+  arp_hdr->sender_hw_addr = CONFIG.nic.ports[port].mac_address;
+  arp_hdr->sender_ip_addr = src->second;
+  memset(arp_hdr->target_hw_addr.bytes, 0, Ethernet::Address::kSize);
+  arp_hdr->target_ip_addr = ip;
+
+  W_DVLOG(1) << "resolving neighbor: " << ToIpv4Address(ip)
+             << " port: " << port << " vlan: " << ToVlan(vlan);
+
+  packet->set_port(port);
+  packet->set_vlan(vlan);
+  if (unlikely(!InsertVlan(packet))) {
+    Packet::Free(packet);
+    return;
+  }
+
+  ctx->Hold(packet);
+}
+
+}  // namespace xlb::modules
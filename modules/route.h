@@ -0,0 +1,179 @@
+#pragma once
+
+#include <deque>
+#include <map>
+#include <stack>
+
+#include <rte_lpm.h>
+
+#include "modules/common.h"
+
+#include "utils/x_map.h"
+
+namespace xlb::modules {
+
+// Routes of ipv4 in the DIR-24-8 table of dpdk, modified only in the trivial
+// and looked up by slaves without locks. A gateway of zero means that the
+// destination is on the local segment, which is the port and the vlan of the
+// route. Groups and tbl8s of lpm freed are only reused after every slave has
+// passed a quiescent point, since slaves may still be reading them.
+class Routes {
+ public:
+  static constexpr size_t kMaxPaths = 8;
+
+  Routes();
+  ~Routes();
+
+  // Replace the gateways of the route if it exists, return false if the table
+  // is full. It should be called in 'AfterGrace', since it may reuse tbl8s.
+  bool Add(const be32_t &prefix, uint8_t depth,
+           const std::vector<be32_t> &gateways, uint16_t port = 0,
+           uint32_t vlan = 0);
+  bool Remove(const be32_t &prefix, uint8_t depth);
+
+  // Call 'func' in the trivial once no slave can be reading anything freed
+  // before
+  void AfterGrace(std::function<void()> &&func);
+
+  // The next hop of 'dst' with its port and vlan, 'hash' picks one of the
+  // equal cost paths
+  bool Lookup(const be32_t &dst, size_t hash, be32_t *hop, uint16_t *port,
+              uint32_t *vlan) const {
+    uint32_t id;
+
+    if (rte_lpm_lookup(lpm_, dst.value(), &id) != 0) return false;
+
+    const Group &group = groups_[id];
+    const be32_t &gateway = group.gateways[hash % group.size];
+
+    *hop = gateway == be32_t(0) ? dst : gateway;
+    *port = group.port;
+    *vlan = group.vlan;
+    return true;
+  }
+
+  // Return false unless 'dst' is on the local segment of a route, whose port
+  // and vlan are set then
+  bool OnLink(const be32_t &dst, uint16_t *port, uint32_t *vlan) const {
+    uint32_t id;
+
+    if (rte_lpm_lookup(lpm_, dst.value(), &id) != 0) return false;
+
+    const Group &group = groups_[id];
+    if (std::any_of(group.gateways, group.gateways + group.size,
+                    [](auto &gateway) { return gateway != be32_t(0); }))
+      return false;
+
+    *port = group.port;
+    *vlan = group.vlan;
+    return true;
+  }
+
+  // Should only be called in the trivial
+  template <typename T>
+  void Foreach(T &&func) {
+    for (auto &rule : rules_) {
+      const Group &group = groups_[rule.second];
+      func(be32_t(rule.first.first), rule.first.second,
+           std::vector<be32_t>(group.gateways, group.gateways + group.size),
+           group.port, group.vlan);
+    }
+  }
+
+  static uint32_t Mask(uint8_t depth) {
+    return depth == 0 ? 0 : ~uint32_t(0) << (32 - depth);
+  }
+
+ private:
+  static constexpr uint32_t kTbl8s = 256;
+
+  struct Group {
+    uint16_t size;
+    uint16_t port;
+    uint32_t vlan;
+    be32_t gateways[kMaxPaths];
+  };
+
+  // Freed groups are returned once all slaves have synced with the trivial
+  void retire(uint32_t id);
+
+  rte_lpm *lpm_;
+
+  // Indexed by the next hop in lpm
+  std::vector<Group> groups_;
+  std::deque<uint32_t> free_groups_;
+
+  // Grace periods not ended yet, and what waits for them
+  size_t graces_;
+  std::vector<std::function<void()>> waiting_;
+
+  // Prefix in host order and depth to the group, only used by the writer
+  std::map<std::pair<uint32_t, uint8_t>, uint32_t> rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(Routes);
+};
+
+// Mac addresses of next hops on each port and vlan cached by each slave,
+// resolved by arp requests of the slave itself and refreshed before they
+// expire. There are at most 'max_neighbors' of them, those not used for the
+// timeout or not resolved after a few probes are evicted.
+class Neighbors {
+ private:
+  using Context = Scheduler::Task::Context;
+
+ public:
+  Neighbors();
+  ~Neighbors() = default;
+
+  // Return nullptr if it is not resolved yet, a request may be sent then
+  const Ethernet::Address *Resolve(Context *ctx, uint16_t port, uint32_t vlan,
+                                   const be32_t &ip);
+
+  // Learned from arp of the neighbor, only wanted ones are updated
+  void Update(uint16_t port, uint32_t vlan, const be32_t &ip,
+              const Ethernet::Address &hw_addr);
+
+  // Check a few of them for eviction in turn, return the number evicted
+  size_t Sweep();
+
+ private:
+  static constexpr size_t kSweepBatch = 16;
+  // Unresolved ones are evicted after this many probes
+  static constexpr uint64_t kMaxProbes = 3;
+
+  struct Entry {
+    uint64_t key;
+    Ethernet::Address hw_addr;
+    bool used;
+    bool resolved;
+    uint64_t since_tsc;
+    uint64_t last_tsc;
+    uint64_t refresh_tsc;
+    uint64_t expire_tsc;
+    uint64_t probe_tsc;
+  };
+
+  // Vlans take 28 bits, see 'ParseVlan' in headers/ether.h
+  static uint64_t key(uint16_t port, uint32_t vlan, const be32_t &ip) {
+    return (uint64_t(port) << 60) | (uint64_t(vlan) << 32) | ip.raw_value();
+  }
+
+  void probe(Context *ctx, uint16_t port, uint32_t vlan, const be32_t &ip);
+
+  // Requests are sent from the kni ip on the first port when untagged,
+  // otherwise from a local ip on the port and vlan. Keyed with an ip of zero.
+  std::unordered_map<uint64_t, be32_t> src_ip_addrs_;
+
+  // Preallocated, indexed by the key
+  utils::vector<Entry> entries_;
+  utils::XMap<uint64_t, uint32_t> idx_map_;
+  std::stack<uint32_t, utils::vector<uint32_t>> idx_pool_;
+  size_t cursor_;
+
+  DISALLOW_COPY_AND_ASSIGN(Neighbors);
+};
+
+}  // namespace xlb::modules
+
+#define ROUTES (utils::UnsafeSingleton<modules::Routes>::instance())
+#define NEIGHBORS (utils::UnsafeSingletonTLS<modules::Neighbors>::instance())
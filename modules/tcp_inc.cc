@@ -1,17 +1,30 @@
 #include "modules/tcp_inc.h"
 #include "modules/ether_out.h"
+#include "modules/port_out.h"
 
 #include "conntrack/conn.h"
+#include "conntrack/frag.h"
+#include "conntrack/persist.h"
 #include "conntrack/table.h"
 
+#include "utils/checksum.h"
+
 namespace xlb::modules {
 
+using conntrack::BasicConn;
+using conntrack::BasicTuple2;
+using conntrack::BasicTuple4;
+using conntrack::BasicVirtSvc;
 using conntrack::Conn;
+using conntrack::Datagram;
+using conntrack::Forward;
+using conntrack::Ipv6Tuple2;
 using conntrack::Tuple2;
 using conntrack::Tuple4;
-using conntrack::VirtSvc;
+using headers::Toa;
 
 using conntrack::get_conntrack_index;
+using conntrack::tcp_bit_set::TCP_SYNACK_SET;
 using conntrack::tcp_bit_set::TCP_SYN_SET;
 
 using conntrack::tcp_conntrack;
@@ -22,11 +35,33 @@ using conntrack::tcp_conntrack::TCP_CONNTRACK_SYN_RECV;
 using conntrack::ip_conntrack_dir::IP_CT_DIR_ORIGINAL;
 using conntrack::ip_conntrack_dir::IP_CT_DIR_REPLY;
 
+using utils::CalculateSum;
+using utils::ChecksumIncrement128;
+using utils::ChecksumIncrement16;
+using utils::ChecksumIncrement32;
+using utils::UpdateChecksum16;
+using utils::UpdateChecksumWithIncrement;
+
 namespace {
 
 constexpr uint64_t ol_flags = PKT_TX_IPV4 | PKT_TX_IP_CKSUM | PKT_TX_TCP_CKSUM;
+constexpr uint64_t ipv6_ol_flags = PKT_TX_IPV6 | PKT_TX_TCP_CKSUM;
+
+// The 16-bit word of data offset and flags
+uint16_t flags_word(const Tcp *tcp) {
+  uint16_t word;
+  memcpy(&word, &tcp->flags - 1, sizeof(word));
+  return word;
+}
+
+// The checksums are kept valid here even if they will be offloaded, since a
+// reset is not on the fast path
+template <typename Ip>
+void make_response_rst(Ip *ip, Tcp *tcp) {
+  auto seq = tcp->seq_num;
+  auto ack = tcp->ack_num;
+  auto word = flags_word(tcp);
 
-void make_response_rst(Ipv4 *ipv4, Tcp *tcp) {
   if (tcp->flags & Tcp::kAck) {
     tcp->seq_num = tcp->ack_num;
     tcp->ack_num = be32_t(0);
@@ -44,28 +79,276 @@ void make_response_rst(Ipv4 *ipv4, Tcp *tcp) {
 
   // TODO: remove options ......
 
+  // Swapping addresses and ports does not change the sum
   std::swap(tcp->src_port, tcp->dst_port);
-  std::swap(ipv4->src, ipv4->dst);
+  std::swap(ip->src, ip->dst);
+
+  uint32_t incr =
+      ChecksumIncrement32(seq.raw_value(), tcp->seq_num.raw_value()) +
+      ChecksumIncrement32(ack.raw_value(), tcp->ack_num.raw_value()) +
+      ChecksumIncrement16(word, flags_word(tcp));
+
+  tcp->checksum = UpdateChecksumWithIncrement(tcp->checksum, incr);
+}
+
+// Rewrite addresses and ports, and patch the checksums from the old and new
+// words (RFC 1624) unless they are offloaded. The addresses are covered by
+// both checksums since they are part of the tcp pseudo header.
+void rewrite(Ipv4 *ipv4, Tcp *tcp, const Tuple2 &src, const Tuple2 &dst,
+             bool offload) {
+  if (!offload) {
+    uint32_t ip_incr =
+        ChecksumIncrement32(ipv4->src.raw_value(), src.ip.raw_value()) +
+        ChecksumIncrement32(ipv4->dst.raw_value(), dst.ip.raw_value());
+    uint32_t tcp_incr =
+        ip_incr +
+        ChecksumIncrement16(tcp->src_port.raw_value(), src.port.raw_value()) +
+        ChecksumIncrement16(tcp->dst_port.raw_value(), dst.port.raw_value());
+
+    ipv4->checksum = UpdateChecksumWithIncrement(ipv4->checksum, ip_incr);
+    tcp->checksum = UpdateChecksumWithIncrement(tcp->checksum, tcp_incr);
+  }
+
+  ipv4->src = src.ip;
+  ipv4->dst = dst.ip;
+  tcp->src_port = src.port;
+  tcp->dst_port = dst.port;
+}
+
+// Ipv6 has no header checksum, the addresses are only covered by the tcp one
+void rewrite(Ipv6 *ipv6, Tcp *tcp, const Ipv6Tuple2 &src,
+             const Ipv6Tuple2 &dst, bool offload) {
+  if (!offload) {
+    uint32_t incr =
+        ChecksumIncrement128(&ipv6->src, &src.ip) +
+        ChecksumIncrement128(&ipv6->dst, &dst.ip) +
+        ChecksumIncrement16(tcp->src_port.raw_value(), src.port.raw_value()) +
+        ChecksumIncrement16(tcp->dst_port.raw_value(), dst.port.raw_value());
+
+    tcp->checksum = UpdateChecksumWithIncrement(tcp->checksum, incr);
+  }
+
+  ipv6->src = src.ip;
+  ipv6->dst = dst.ip;
+  tcp->src_port = src.port;
+  tcp->dst_port = dst.port;
+}
+
+// Leave the checksums to nic, only the pseudo header is summed here
+void offload_cksum(Packet *packet, Ipv4 *ipv4, Tcp *tcp) {
+  packet->set_l4_len(tcp->offset * 4);
+  packet->set_ol_flags(ol_flags);
+
+  ipv4->checksum = 0;
+  tcp->checksum = 0;
+  tcp->checksum = rte_ipv4_phdr_cksum(
+      reinterpret_cast<struct ipv4_hdr *>(ipv4), ol_flags);
+}
+
+void offload_cksum(Packet *packet, Ipv6 *ipv6, Tcp *tcp) {
+  packet->set_l4_len(tcp->offset * 4);
+  packet->set_ol_flags(ipv6_ol_flags);
+
+  tcp->checksum = 0;
+  tcp->checksum = rte_ipv6_phdr_cksum(
+      reinterpret_cast<struct ipv6_hdr *>(ipv6), ipv6_ol_flags);
+}
+
+// Rewrite addresses of a fragment without tcp header, the tcp checksum has
+// been patched with the first fragment
+void rewrite(Ipv4 *ipv4, const be32_t &src, const be32_t &dst) {
+  uint32_t incr = ChecksumIncrement32(ipv4->src.raw_value(), src.raw_value()) +
+                  ChecksumIncrement32(ipv4->dst.raw_value(), dst.raw_value());
+
+  ipv4->checksum = UpdateChecksumWithIncrement(ipv4->checksum, incr);
+  ipv4->src = src;
+  ipv4->dst = dst;
 }
 
-bool add_ttm_option(Tcp *hdr, Tuple2 &cli) {
-  // TODO: ......
+// Bytes added in front of the inner ip header by tunnels
+uint16_t tunnel_overhead(Forward forward) {
+  return sizeof(Ipv4) + (forward == Forward::kGue ? sizeof(Udp) : 0);
+}
+
+// Encapsulate the ipv4 packet from 'src' to 'dst' in the headroom, the
+// ethernet header is moved ahead and the inner packet is left untouched.
+// Return false if it would exceed the mtu.
+bool encapsulate(Packet *packet, Forward forward, const Tuple2 &src,
+                 const be32_t &dst) {
+  auto l2_len = packet->l2_len();
+  auto *inner = packet->head_data<Ipv4 *>(l2_len);
+  uint16_t overhead = tunnel_overhead(forward);
+  uint16_t length = inner->length.value() + overhead;
+
+  if (unlikely(length > CONFIG.nic.mtu)) return false;
+
+  auto *head = packet->prepend(overhead);
+  if (unlikely(!head)) return false;
+
+  memmove(head, static_cast<uint8_t *>(head) + overhead, l2_len);
+
+  fill_tunnel_header(packet->head_data<Ipv4 *>(l2_len), inner, src, dst,
+                     forward == Forward::kGue ? CONFIG.tunnel.gue_port : 0);
+
+  packet->set_l3_len(sizeof(Ipv4));
+
   return true;
 }
 
+// Insert the client address as a tcp option for the toa module of rs, which
+// reads it from the ACK completing the handshake. The headers are shifted
+// into the headroom instead of moving the payload, and 'ip' and 'tcp' are
+// updated to where they are. Nothing is done if there is no room.
+void add_toa_option(Packet *packet, Ipv4 *&ip, Tcp *&tcp, const Tuple2 &cli) {
+  size_t tcp_len = tcp->offset * 4;
+  size_t hdr_len = packet->l2_len() + packet->l3_len() + tcp_len;
+
+  if (tcp_len + sizeof(Toa) > 60 ||
+      ip->length.value() + sizeof(Toa) > CONFIG.nic.mtu) {
+    W_DVLOG(1) << "no room for toa option";
+    return;
+  }
+
+  auto *head = packet->prepend(sizeof(Toa));
+  if (unlikely(!head)) return;
+
+  utils::ShiftBytesLeftSmall(static_cast<uint8_t *>(head),
+                             hdr_len + sizeof(Toa), sizeof(Toa));
+
+  ip = packet->head_data<Ipv4 *>(packet->l2_len());
+  tcp = packet->head_data<Tcp *>(packet->l2_len() + packet->l3_len());
+
+  append_toa_option(ip, tcp, cli);
+}
+
 }  // namespace
 
+void clamp_mss(Tcp *tcp, uint16_t mss) {
+  auto *opt = reinterpret_cast<uint8_t *>(tcp + 1);
+  auto *end = reinterpret_cast<uint8_t *>(tcp) + tcp->offset * 4;
+
+  while (opt < end) {
+    if (opt[0] == Tcp::kEol) return;
+    if (opt[0] == Tcp::kNop) {
+      ++opt;
+      continue;
+    }
+
+    if (opt + 1 >= end || opt[1] < 2 || opt + opt[1] > end) return;
+
+    if (opt[0] == Tcp::kMss && opt[1] == 4) {
+      be16_t old_mss, new_mss(mss);
+      memcpy(&old_mss, opt + 2, sizeof(old_mss));
+      if (old_mss.value() <= mss) return;
+
+      memcpy(opt + 2, &new_mss, sizeof(new_mss));
+
+      uint16_t old_word = old_mss.raw_value();
+      uint16_t new_word = new_mss.raw_value();
+      // A value at an odd offset is summed with its bytes swapped
+      if ((opt - reinterpret_cast<uint8_t *>(tcp)) % 2) {
+        old_word = __builtin_bswap16(old_word);
+        new_word = __builtin_bswap16(new_word);
+      }
+
+      tcp->checksum = UpdateChecksum16(tcp->checksum, old_word, new_word);
+      return;
+    }
+
+    opt += opt[1];
+  }
+}
+
+void fill_tunnel_header(Ipv4 *outer, const Ipv4 *inner, const Tuple2 &src,
+                        const be32_t &dst, uint16_t gue_port) {
+  uint16_t length = inner->length.value() + sizeof(Ipv4) +
+                    (gue_port ? sizeof(Udp) : 0);
+
+  // The id and DF of inner are kept, so the outer is fragmented by the path
+  // only if the client allows
+  outer->version = 4;
+  outer->header_length = sizeof(Ipv4) / 4;
+  outer->type_of_service = inner->type_of_service;
+  outer->length = be16_t(length);
+  outer->id = inner->id;
+  outer->fragment_offset = inner->fragment_offset & be16_t(Ipv4::kDF);
+  outer->ttl = 64;
+  outer->protocol = gue_port ? Ipv4::kUdp : Ipv4::kIpIp;
+  outer->src = src.ip;
+  outer->dst = dst;
+  // Cheap enough for 20 bytes, not worth the offload flags
+  outer->checksum = 0;
+  outer->checksum = ~CalculateSum(outer, sizeof(Ipv4));
+
+  if (gue_port) {
+    auto *udp = reinterpret_cast<Udp *>(outer + 1);
+    // The local port differs between connections, as the entropy for rss
+    // and ecmp
+    udp->src_port = src.port;
+    udp->dst_port = be16_t(gue_port);
+    udp->length = be16_t(length - sizeof(Ipv4));
+    // Allowed to be zero in ipv4
+    udp->checksum = 0;
+  }
+}
+
+void append_toa_option(Ipv4 *ip, Tcp *tcp, const Tuple2 &cli) {
+  auto *toa = reinterpret_cast<Toa *>(reinterpret_cast<uint8_t *>(tcp) +
+                                      tcp->offset * 4);
+  toa->code = Tcp::kToa;
+  toa->size = sizeof(Toa);
+  toa->port = cli.port;
+  toa->addr = cli.ip;
+
+  be16_t ip_len = ip->length + be16_t(sizeof(Toa));
+  // The length of tcp in the pseudo header grows as much as the ip one
+  uint32_t len_incr =
+      ChecksumIncrement16(ip->length.raw_value(), ip_len.raw_value());
+  auto word = flags_word(tcp);
+
+  ip->length = ip_len;
+  tcp->offset += sizeof(Toa) / 4;
+
+  // The option starts at an even offset, so its words are summed as they are
+  uint32_t tcp_incr = len_incr + ChecksumIncrement16(word, flags_word(tcp)) +
+                      CalculateSum(toa, sizeof(Toa));
+
+  ip->checksum = UpdateChecksumWithIncrement(ip->checksum, len_incr);
+  tcp->checksum = UpdateChecksumWithIncrement(tcp->checksum, tcp_incr);
+}
+
 void TcpInc::InitInTrivial() {
   STABLE_INIT();
+  STABLE6_INIT();
   Exec::RegisterTrivial();
 
   RegisterTask<TS("exec_sync")>(
       [](Context *) -> Result { return {.packets = Exec::Sync()}; });
+
+  RegisterTask<TS("outlier_detect")>([](Context *) -> Result {
+    return {.packets = STABLE.DetectOutliers() + STABLE6.DetectOutliers()};
+  });
+
+  RegisterTask<TS("rtt_update")>([](Context *) -> Result {
+    return {.packets = STABLE.UpdateRtt() + STABLE6.UpdateRtt()};
+  });
+
+  RegisterTask<TS("conns_balance")>([](Context *) -> Result {
+    return {.packets = STABLE.BalanceConns() + STABLE6.BalanceConns()};
+  });
+}
+
+TcpInc::TcpInc()
+    : tx_cksum_offload_(CONFIG.nic.tx_cksum_offload),
+      lend_timeout_(conntrack::max_conntrack_timeout() * utils::tsc_sec) {
+  for (size_t i = 0; i < CONFIG.slave_cores.size(); ++i)
+    rings_.emplace_back(std::make_unique<Ring>(kHandoffRingSize));
 }
 
-void TcpInc::InitInSlave(uint16_t) {
+void TcpInc::InitInSlave(uint16_t wid) {
   STABLE_INIT();
   CTABLE_INIT();
+  PTABLE_INIT();
   Exec::RegisterSlave();
 
   RegisterTask<TS("stable_sync")>(
@@ -74,68 +357,203 @@ void TcpInc::InitInSlave(uint16_t) {
   RegisterTask<TS("ctable_sync")>(
       [](Context *) -> Result { return {.packets = CTABLE.Sync()}; });
 
+  if (CONFIG.svc.max_ipv6_conn > 0) {
+    STABLE6_INIT();
+    CTABLE6_INIT();
+
+    RegisterTask<TS("stable6_sync")>(
+        [](Context *) -> Result { return {.packets = STABLE6.Sync()}; });
+
+    RegisterTask<TS("ctable6_sync")>(
+        [](Context *) -> Result { return {.packets = CTABLE6.Sync()}; });
+  }
+
+  RegisterTask<TS("ptable_sync")>(
+      [](Context *) -> Result { return {.packets = PTABLE.Sync()}; });
+
+  if (CONFIG.frag.max_datagrams > 0) {
+    FTABLE_INIT();
+    RegisterTask<TS("ftable_sync")>(
+        [](Context *) -> Result { return {.packets = FTABLE.Sync()}; });
+  }
+
   RegisterTask<TS("exec_sync")>(
       [](Context *) -> Result { return {.packets = Exec::Sync()}; });
+
+  RegisterTask<TS("tcp_handoff")>([this, wid](Context *ctx) -> Result {
+    PacketBatch batch;
+
+    batch.SetCnt(rings_[wid]->Pop(batch.pkts(), Packet::kMaxBurst));
+
+    for (Packet &packet : batch) {
+      if (packet.head_data<Ipv4 *>(packet.l2_len())->version == 4)
+        forward<Ipv4>(ctx, &packet, false, true);
+      else
+        forward<Ipv6>(ctx, &packet, false, true);
+    }
+
+    if (!ctx->stage_batch().Empty()) {
+      Handle<PortOut<PMD>>(ctx, &ctx->stage_batch());
+      ctx->stage_batch().Clear();
+    }
+
+    return {.packets = batch.cnt()};
+  });
+
+  // A draining slave is parked once its connections are gone
+  RegisterTask<TS("drain")>([wid](Context *) -> Result {
+    if (likely(Worker::state(wid) != Worker::Draining)) return {.packets = 0};
+
+    if (CTABLE.Count() == 0 &&
+        (CONFIG.svc.max_ipv6_conn == 0 || CTABLE6.Count() == 0))
+      Worker::MarkParked(wid);
+
+    return {.packets = 0};
+  });
+}
+
+bool TcpInc::handoff(Packet *packet) {
+  if (!packet->has_rss_hash()) return false;
+
+  int lender = PMD::All()[packet->port()]->Lender(packet->rss_hash(),
+                                                  lend_timeout_);
+  if (lender < 0 || lender == W_ID) return false;
+
+  if (unlikely(!rings_[lender]->Push(packet))) Packet::Free(packet);
+  return true;
 }
 
 template <>
 void TcpInc::Process<PMD>(Context *ctx, Packet *packet) {
-  auto *ip_hdr = packet->head_data<Ipv4 *>(packet->l2_len());
-  auto *tcp_hdr = packet->head_data<Tcp *>(packet->l2_len() + packet->l3_len());
+  if (unlikely(!packet->rx_l4_cksum_good())) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "invalid tcp checksum";
+    return;
+  }
+
+  forward<Ipv4>(ctx, packet, false);
+}
 
+template <>
+void TcpInc::Process<Inet6>(Context *ctx, Packet *packet) {
   if (unlikely(!packet->rx_l4_cksum_good())) {
     ctx->Drop(packet);
     W_DVLOG(1) << "invalid tcp checksum";
     return;
   }
 
-  W_DVLOG(3) << "tcp packet from: " << ToIpv4Address(ip_hdr->src)
+  forward<Ipv6>(ctx, packet, false);
+}
+
+template <>
+void TcpInc::Process<Fragment>(Context *ctx, Packet *packet) {
+  auto *ip_hdr = packet->head_data<Ipv4 *>(packet->l2_len());
+
+  auto *dgram =
+      FTABLE.Get({ip_hdr->src, ip_hdr->dst, ip_hdr->id, ip_hdr->protocol});
+  if (unlikely(!dgram)) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "too many fragmented datagrams";
+    return;
+  }
+
+  if (ip_hdr->fragment_offset & be16_t(Ipv4::kOffsetMask)) {
+    if (likely(dgram->learned())) {
+      forward(ctx, packet, dgram);
+    } else if (!FTABLE.Hold(dgram, packet)) {
+      ctx->Drop(packet);
+      W_DVLOG(1) << "too many held fragments";
+    }
+    return;
+  }
+
+  // The first fragment must carry the whole tcp header
+  if (unlikely(packet->head_len() <
+               int(packet->l2_len() + packet->l3_len() + sizeof(Tcp)))) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "tcp header is fragmented";
+    return;
+  }
+
+  auto *tcp_hdr = packet->head_data<Tcp *>(packet->l2_len() + packet->l3_len());
+
+  PacketBatch held;
+  held.Clear();
+  FTABLE.Learn(dgram, tcp_hdr->src_port, tcp_hdr->dst_port, &held);
+
+  forward<Ipv4>(ctx, packet, true);
+
+  if (likely(held.Empty())) return;
+
+  // Flush the stage batch first so that it can not overflow
+  if (ctx->stage_batch().free_cnt() < held.cnt()) {
+    Handle<PortOut<PMD>>(ctx, &ctx->stage_batch());
+    ctx->stage_batch().Clear();
+  }
+
+  for (Packet &p : held) forward(ctx, &p, dgram);
+}
+
+template <typename Ip>
+void TcpInc::forward(Context *ctx, Packet *packet, bool fragment,
+                     bool handed) {
+  using Addr = decltype(Ip::src);
+
+  auto *ip_hdr = packet->head_data<Ip *>(packet->l2_len());
+  auto *tcp_hdr = packet->head_data<Tcp *>(packet->l2_len() + packet->l3_len());
+
+  bool offload = tx_cksum_offload_ && !fragment;
+
+  W_DVLOG(3) << "tcp packet from: " << ToIpAddress(ip_hdr->src)
              << " port: " << tcp_hdr->src_port.value()
-             << " to: " << ToIpv4Address(ip_hdr->dst)
+             << " to: " << ToIpAddress(ip_hdr->dst)
              << " port: " << tcp_hdr->dst_port.value();
 
   auto send = [&]() {
-    packet->set_l4_len(tcp_hdr->offset * 4);
-    packet->set_ol_flags(ol_flags);
-
-    ip_hdr->checksum = 0;
-    tcp_hdr->checksum = 0;
-    tcp_hdr->checksum = rte_ipv4_phdr_cksum(
-        reinterpret_cast<struct ipv4_hdr *>(ip_hdr), ol_flags);
+    if (offload) offload_cksum(packet, ip_hdr, tcp_hdr);
 
     Handle<EtherOut, PMD>(ctx, packet);
   };
 
+  auto reset = [&]() {
+    if (fragment) {
+      ctx->Drop(packet);
+      return;
+    }
+
+    make_response_rst(ip_hdr, tcp_hdr);
+    send();
+  };
+
   auto set = get_conntrack_index(tcp_hdr);
-  Tuple4 tuple{{ip_hdr->src, tcp_hdr->src_port},
-               {ip_hdr->dst, tcp_hdr->dst_port}};
+  BasicTuple4<Addr> tuple{{ip_hdr->src, tcp_hdr->src_port},
+                          {ip_hdr->dst, tcp_hdr->dst_port}};
 
-  VirtSvc::Ptr vs;
-  Conn *conn;
+  typename BasicVirtSvc<Addr>::Ptr vs;
+  BasicConn<Addr> *conn;
 
   //  std::pair<bool, tcp_conntrack> trans;
 
   switch (set) {
     case TCP_SYN_SET:
-      if (!(vs = STABLE.FindVs(tuple.dst))) {
-        make_response_rst(ip_hdr, tcp_hdr);
-        send();
+      // A vs only takes clients from its own vlan
+      vs = STABLE_OF(Addr).FindVs(tuple.dst);
+      if (!vs || vs->vlan() != packet->vlan()) {
+        reset();
         return;
       }
-      if (!(conn = CTABLE.Get(vs, tuple.src))) {
-        make_response_rst(ip_hdr, tcp_hdr);
-        send();
+      if (!(conn = CTABLE_OF(Addr).Get(vs, tuple.src))) {
+        reset();
         return;
       }
       break;
 
     default:
-      if (!(conn = CTABLE.Find(tuple))) {
-        if (tcp_hdr->flags & Tcp::kRst) {
+      if (!(conn = CTABLE_OF(Addr).Find(tuple))) {
+        if (handed || tcp_hdr->flags & Tcp::kRst) {
           ctx->Drop(packet);
-        } else {
-          make_response_rst(ip_hdr, tcp_hdr);
-          send();
+        } else if (fragment || !handoff(packet)) {
+          reset();
         }
 
         return;
@@ -143,33 +561,97 @@ void TcpInc::Process<PMD>(Context *ctx, Packet *packet) {
       break;
   }
 
+  // So that the slave which took back the bucket keeps handing packets here
+  if (handed) PMD::All()[packet->port()]->KeepLent(packet->rss_hash());
+
+  auto real = conn->real();
+  auto virt = conn->virt();
+
+  if (virt->forward() != Forward::kFullNat) {
+    conn->Refresh(set);
+
+    real->IncrPacketsIn(1);
+    real->IncrBytesIn(packet->data_len());
+    virt->IncrPacketsIn(1);
+    virt->IncrBytesIn(packet->data_len());
+
+    // The checksum is not offloaded here, so the mss is patched incrementally.
+    // SYN-ACK never comes back, so rs has to lower its own mss for tunnels.
+    if (set == TCP_SYN_SET && !fragment) clamp_mss(tcp_hdr, virt->mss());
+
+    bypass(ctx, packet, conn);
+    return;
+  }
+
   auto dir = conn->direction(tuple);
 
   // TODO: reset invalid ......
-  if (conn->UpdateState(set, dir).first &&
-      !add_ttm_option(tcp_hdr, tuple.src)) {
-    make_response_rst(ip_hdr, tcp_hdr);
-    send();
+  bool est = conn->UpdateState(set, dir).first;
+
+  // Both sides learn the mss of each other from the handshake, the one in
+  // SYN-ACK leaves room for toa
+  if ((set == TCP_SYN_SET || set == TCP_SYNACK_SET) && !fragment)
+    clamp_mss(tcp_hdr, virt->mss());
+
+  // Toa is only for ipv4, and not for fragments whose length can not change
+  if constexpr (std::is_same_v<Ip, Ipv4>)
+    if (est && !fragment && dir == IP_CT_DIR_ORIGINAL)
+      add_toa_option(packet, ip_hdr, tcp_hdr, tuple.src);
+
+  if (dir == IP_CT_DIR_ORIGINAL) {
+    rewrite(ip_hdr, tcp_hdr, conn->local(), real->tuple(), offload);
+
+    real->IncrPacketsIn(1);
+    real->IncrBytesIn(packet->data_len());
+    virt->IncrPacketsIn(1);
+    virt->IncrBytesIn(packet->data_len());
+  } else {
+    rewrite(ip_hdr, tcp_hdr, virt->tuple(), conn->client(), offload);
+
+    real->IncrPacketsOut(1);
+    real->IncrBytesOut(packet->data_len());
+    virt->IncrPacketsOut(1);
+    virt->IncrBytesOut(packet->data_len());
+  }
+
+  send();
+}
+
+void TcpInc::forward(Context *ctx, Packet *packet, Datagram *dgram) {
+  auto *ip_hdr = packet->head_data<Ipv4 *>(packet->l2_len());
+
+  Tuple4 tuple{{ip_hdr->src, dgram->src_port()},
+               {ip_hdr->dst, dgram->dst_port()}};
+
+  Conn *conn = CTABLE.Find(tuple);
+  if (unlikely(!conn)) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "no connection for fragment";
+    return;
   }
 
   auto real = conn->real();
   auto virt = conn->virt();
 
-  if (dir == IP_CT_DIR_ORIGINAL) {
-    ip_hdr->src = conn->local().ip;
-    ip_hdr->dst = real->tuple().ip;
-    tcp_hdr->src_port = conn->local().port;
-    tcp_hdr->dst_port = real->tuple().port;
+  if (virt->forward() != Forward::kFullNat) {
+    real->IncrPacketsIn(1);
+    real->IncrBytesIn(packet->data_len());
+    virt->IncrPacketsIn(1);
+    virt->IncrBytesIn(packet->data_len());
+
+    bypass(ctx, packet, conn);
+    return;
+  }
+
+  if (conn->direction(tuple) == IP_CT_DIR_ORIGINAL) {
+    rewrite(ip_hdr, conn->local().ip, real->tuple().ip);
 
     real->IncrPacketsIn(1);
     real->IncrBytesIn(packet->data_len());
     virt->IncrPacketsIn(1);
     virt->IncrBytesIn(packet->data_len());
   } else {
-    ip_hdr->src = virt->tuple().ip;
-    ip_hdr->dst = conn->client().ip;
-    tcp_hdr->src_port = virt->tuple().port;
-    tcp_hdr->dst_port = conn->client().port;
+    rewrite(ip_hdr, virt->tuple().ip, conn->client().ip);
 
     real->IncrPacketsOut(1);
     real->IncrBytesOut(packet->data_len());
@@ -177,7 +659,32 @@ void TcpInc::Process<PMD>(Context *ctx, Packet *packet) {
     virt->IncrBytesOut(packet->data_len());
   }
 
-  send();
+  Handle<EtherOut, PMD>(ctx, packet);
+}
+
+template <typename Addr>
+void TcpInc::bypass(Context *ctx, Packet *packet, BasicConn<Addr> *conn) {
+  auto forward = conn->forward();
+  auto &real = conn->real();
+
+  if (forward == Forward::kDr) {
+    packet->head_data<Ethernet *>()->dst_addr = real->hw_addr();
+    packet->set_port(real->port());
+    packet->set_vlan(real->vlan());
+    Handle<EtherOut, Neighbor>(ctx, packet);
+    return;
+  }
+
+  // Tunnels are only for ipv4
+  if constexpr (is_ipv4_v<Addr>) {
+    if (likely(encapsulate(packet, forward, conn->local(), real->tuple().ip))) {
+      Handle<EtherOut, PMD>(ctx, packet);
+      return;
+    }
+  }
+
+  ctx->Drop(packet);
+  W_DVLOG(1) << "packet is too large to encapsulate";
 }
 
 }  // namespace xlb::modules
@@ -2,15 +2,78 @@
 
 #include "modules/common.h"
 
+#include "conntrack/tuple.h"
+
+namespace xlb::conntrack {
+class Datagram;
+template <typename Addr>
+class BasicConn;
+}  // namespace xlb::conntrack
+
 namespace xlb::modules {
 
+// Header rewrites of TcpInc, the checksums are kept valid without a full
+// recompute.
+
+// Lower the mss option of SYN or SYN-ACK to 'mss' if it is larger, so that
+// the segments of the peer fit in the path mtu
+void clamp_mss(Tcp *tcp, uint16_t mss);
+// Fill the tunnel header from 'src' to 'dst' in front of 'inner', of ipip if
+// 'gue_port' is 0, otherwise of gue with the udp header
+void fill_tunnel_header(Ipv4 *outer, const Ipv4 *inner,
+                        const conntrack::Tuple2 &src, const be32_t &dst,
+                        uint16_t gue_port);
+// Append the client address as a toa option to the options, there must be
+// room for it right behind them
+void append_toa_option(Ipv4 *ip, Tcp *tcp, const conntrack::Tuple2 &cli);
+
+// Tag of ipv4 fragments
+struct Fragment {};
+// Tag of ipv6 packets
+struct Inet6 {};
+
 class TcpInc : public Module {
  public:
+  TcpInc();
+
   void InitInTrivial() override;
   void InitInSlave(uint16_t) override;
 
   template <typename Tag = NoneTag>
   inline void Process(Context *ctx, Packet *packet);
+
+ private:
+  using Ring = utils::LockLessQueue<Packet *, false, true>;
+
+  static constexpr size_t kHandoffRingSize = 4096;
+
+  // The checksums of fragments are always patched incrementally, since the nic
+  // can only sum a single fragment and a reset can not be sent for them. 'Ip'
+  // is the header of either family. A packet 'handed' by another slave is
+  // dropped if its connection is not here either.
+  template <typename Ip>
+  void forward(Context *ctx, Packet *packet, bool fragment,
+               bool handed = false);
+  // For the fragments but the first one, which only have addresses rewritten
+  void forward(Context *ctx, Packet *packet, conntrack::Datagram *dgram);
+  // Pass the packet to rs of a connection in DR or tunnel modes without
+  // rewriting, since replies never come back
+  template <typename Addr>
+  void bypass(Context *ctx, Packet *packet, conntrack::BasicConn<Addr> *conn);
+
+  // Buckets of rss are moved between slaves when they are parked or
+  // activated, so a packet without connection is handed to the slave that
+  // served its bucket before, where it may be. Return false if there is none.
+  bool handoff(Packet *packet);
+
+  // Otherwise the checksums are patched incrementally in software
+  bool tx_cksum_offload_;
+  // Packets are handed to the slave that served their bucket before until it
+  // has had no connection there for this long
+  uint64_t lend_timeout_;
+
+  // Of the packets handed to each slave
+  std::vector<std::unique_ptr<Ring>> rings_;
 };
 
 }  // namespace xlb::modules
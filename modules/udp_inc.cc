@@ -0,0 +1,191 @@
+#include "modules/udp_inc.h"
+#include "modules/ether_out.h"
+
+#include "conntrack/flow.h"
+#include "conntrack/table.h"
+
+#include "utils/checksum.h"
+
+namespace xlb::modules {
+
+using conntrack::Flow;
+using conntrack::Protocol;
+using conntrack::RealSvc;
+using conntrack::Tuple2;
+using conntrack::Tuple4;
+using conntrack::VirtSvc;
+
+using conntrack::ip_conntrack_dir::IP_CT_DIR_ORIGINAL;
+
+using utils::ChecksumIncrement16;
+using utils::ChecksumIncrement32;
+using utils::UpdateChecksumWithIncrement;
+
+namespace {
+
+constexpr uint64_t ol_flags = PKT_TX_IPV4 | PKT_TX_IP_CKSUM | PKT_TX_UDP_CKSUM;
+
+// Return the server id of 'id_len' bytes encoded in plain text in the
+// destination connection id of a quic packet (QUIC-LB), 0 if there is none
+uint64_t quic_server_id(const uint8_t *data, int len, uint8_t id_len) {
+  const uint8_t *cid;
+
+  if (len < 1) return 0;
+
+  if (data[0] & 0x80) {
+    // Long header: flags, version(4), length of dcid and dcid
+    if (len < 6 || data[5] < 1 + id_len || len < 6 + data[5]) return 0;
+    cid = data + 6;
+  } else {
+    // Short header: flags and dcid, whose length is up to the server
+    if (len < 2 + id_len) return 0;
+    cid = data + 1;
+  }
+
+  // Config rotation bits of all ones mean the connection id is not routable
+  if ((cid[0] >> 5) == 0x7) return 0;
+
+  uint64_t id = 0;
+  for (auto i : irange(id_len)) id = id << 8 | cid[1 + i];
+
+  return id;
+}
+
+// Rewrite addresses and ports like 'TcpInc' does, but a zero udp checksum
+// means there is none and must be kept
+void rewrite(Ipv4 *ipv4, Udp *udp, const Tuple2 &src, const Tuple2 &dst,
+             bool offload) {
+  if (!offload) {
+    uint32_t ip_incr =
+        ChecksumIncrement32(ipv4->src.raw_value(), src.ip.raw_value()) +
+        ChecksumIncrement32(ipv4->dst.raw_value(), dst.ip.raw_value());
+
+    ipv4->checksum = UpdateChecksumWithIncrement(ipv4->checksum, ip_incr);
+
+    if (udp->checksum != 0) {
+      uint32_t udp_incr =
+          ip_incr +
+          ChecksumIncrement16(udp->src_port.raw_value(), src.port.raw_value()) +
+          ChecksumIncrement16(udp->dst_port.raw_value(), dst.port.raw_value());
+
+      udp->checksum = UpdateChecksumWithIncrement(udp->checksum, udp_incr);
+      // A computed zero is transmitted as all ones (RFC 768)
+      if (udp->checksum == 0) udp->checksum = 0xffff;
+    }
+  }
+
+  ipv4->src = src.ip;
+  ipv4->dst = dst.ip;
+  udp->src_port = src.port;
+  udp->dst_port = dst.port;
+}
+
+// Leave the checksums to nic, only the pseudo header is summed here
+void offload_cksum(Packet *packet, Ipv4 *ipv4, Udp *udp) {
+  packet->set_l4_len(sizeof(Udp));
+  packet->set_ol_flags(ol_flags);
+
+  ipv4->checksum = 0;
+  udp->checksum = 0;
+  udp->checksum = rte_ipv4_phdr_cksum(
+      reinterpret_cast<struct ipv4_hdr *>(ipv4), ol_flags);
+}
+
+}  // namespace
+
+void UdpInc::InitInSlave(uint16_t) {
+  if (CONFIG.udp.max_flows == 0) return;
+
+  UTABLE_INIT();
+
+  RegisterTask<TS("utable_sync")>(
+      [](Context *) -> Result { return {.packets = UTABLE.Sync()}; });
+}
+
+template <>
+void UdpInc::Process<PMD>(Context *ctx, Packet *packet) {
+  auto *ip_hdr = packet->head_data<Ipv4 *>(packet->l2_len());
+  auto *udp_hdr = packet->head_data<Udp *>(packet->l2_len() + packet->l3_len());
+
+  if (unlikely(packet->head_len() <
+               int(packet->l2_len() + packet->l3_len() + sizeof(Udp)))) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "truncated udp header";
+    return;
+  }
+
+  if (unlikely(!packet->rx_l4_cksum_good() && udp_hdr->checksum != 0)) {
+    ctx->Drop(packet);
+    W_DVLOG(1) << "invalid udp checksum";
+    return;
+  }
+
+  W_DVLOG(3) << "udp packet from: " << ToIpv4Address(ip_hdr->src)
+             << " port: " << udp_hdr->src_port.value()
+             << " to: " << ToIpv4Address(ip_hdr->dst)
+             << " port: " << udp_hdr->dst_port.value();
+
+  Tuple4 tuple{{ip_hdr->src, udp_hdr->src_port},
+               {ip_hdr->dst, udp_hdr->dst_port}};
+
+  // Each packet but the first one of a flow costs a single lookup
+  Flow *flow = UTABLE.Find(tuple);
+  VirtSvc::Ptr vs;
+  if (flow) {
+    if (flow->direction(tuple) == IP_CT_DIR_ORIGINAL) vs = flow->virt();
+  } else {
+    vs = STABLE.FindVs(tuple.dst, Protocol::kUdp);
+    if (!vs || vs->vlan() != packet->vlan()) {
+      ctx->Drop(packet);
+      return;
+    }
+  }
+
+  // Each packet of a quic connection from the client is routed on its
+  // connection id, so it sticks to the rs that issued the id even if the
+  // client moves to another tuple. The flow only keeps the local tuple to
+  // translate the replies, and is replaced once it names another rs.
+  RealSvc::Ptr rs;
+  if (vs && vs->quic_server_id_len()) {
+    int len = packet->head_len() -
+              int(packet->l2_len() + packet->l3_len() + sizeof(Udp));
+    auto id = quic_server_id(reinterpret_cast<uint8_t *>(udp_hdr + 1), len,
+                             vs->quic_server_id_len());
+    if (id != 0) rs = vs->FindRs(id);
+
+    if (flow && rs && rs != flow->real()) {
+      UTABLE.Remove(flow);
+      flow = nullptr;
+    }
+  }
+
+  if (unlikely(!flow) && !(flow = UTABLE.Get(vs, tuple.src, rs))) {
+    ctx->Drop(packet);
+    return;
+  }
+
+  auto real = flow->real();
+  auto virt = flow->virt();
+
+  if (flow->direction(tuple) == IP_CT_DIR_ORIGINAL) {
+    rewrite(ip_hdr, udp_hdr, flow->local(), real->tuple(), tx_cksum_offload_);
+
+    real->IncrPacketsIn(1);
+    real->IncrBytesIn(packet->data_len());
+    virt->IncrPacketsIn(1);
+    virt->IncrBytesIn(packet->data_len());
+  } else {
+    rewrite(ip_hdr, udp_hdr, virt->tuple(), flow->client(), tx_cksum_offload_);
+
+    real->IncrPacketsOut(1);
+    real->IncrBytesOut(packet->data_len());
+    virt->IncrPacketsOut(1);
+    virt->IncrBytesOut(packet->data_len());
+  }
+
+  if (tx_cksum_offload_) offload_cksum(packet, ip_hdr, udp_hdr);
+
+  Handle<EtherOut, PMD>(ctx, packet);
+}
+
+}  // namespace xlb::modules
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "modules/common.h"
+
+namespace xlb::modules {
+
+// Udp of ipv4 is balanced by flows which live until they are idle for a
+// while, the service tables are shared with 'TcpInc'
+class UdpInc : public Module {
+ public:
+  UdpInc() : tx_cksum_offload_(CONFIG.nic.tx_udp_cksum_offload) {}
+
+  void InitInSlave(uint16_t) override;
+
+  template <typename Tag = NoneTag>
+  inline void Process(Context *ctx, Packet *packet);
+
+ private:
+  // Otherwise the checksums are patched incrementally in software
+  bool tx_cksum_offload_;
+};
+
+}  // namespace xlb::modules
@@ -8,6 +8,8 @@
 #include <rte_bus_pci.h>
 #include <rte_ethdev.h>
 #include <rte_ethdev_pci.h>
+#include <rte_eth_bond.h>
+#include <rte_eth_bond_8023ad.h>
 #include <rte_flow.h>
 #include <rte_ip.h>
 #include <rte_kni.h>
@@ -13,20 +13,22 @@ void init_driver() { rte_kni_init(1); }
 KNI::KNI() : Port() {
   init_driver();
 
-  auto &pmd_port = utils::Singleton<PMD>::instance();
+  // Bound to the first port
+  auto &pmd_port = *PMD::All().front();
 
   struct rte_kni_conf kni_conf = {"xlb",
                                   CONFIG.master_core,
                                   pmd_port.dpdk_port_id(),
                                   XBUF_SIZE,
-                                  pmd_port.dev_info()->pci_dev->addr,
-                                  pmd_port.dev_info()->pci_dev->id,
+                                  pmd_port.pci_dev()->addr,
+                                  pmd_port.pci_dev()->id,
                                   1};
 
   struct rte_kni_ops kni_ops = {0, nullptr, nullptr};
 
-  kni_ = rte_kni_alloc(utils::Singleton<PacketPool>::instance().pool(),
-                       &kni_conf, &kni_ops);
+  // Packets from kernel are received by master
+  int sid = utils::CoreSocketId(CONFIG.master_core).value();
+  kni_ = rte_kni_alloc(PacketPool::Of(sid).pool(), &kni_conf, &kni_ops);
   CHECK_NOTNULL(kni_);
 
   conf_ = pmd_port.conf();
@@ -52,7 +54,10 @@ uint16_t KNI::Recv(uint16_t qid, Packet **pkts, uint16_t cnt) {
     M::Adder<TS("rx_packets")>() << recv;
 
     uint64_t bytes = 0;
-    for (auto i : utils::irange(recv)) bytes += pkts[i]->data_len();
+    for (auto i : utils::irange(recv)) {
+      bytes += pkts[i]->data_len();
+      pkts[i]->set_port(0);
+    }
 
     M::Adder<TS("rx_bytes")>() << bytes;
   }
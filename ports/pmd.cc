@@ -1,29 +1,88 @@
 #include "ports/pmd.h"
 
+#include "runtime/worker.h"
+
 namespace xlb::ports {
 
 namespace {
 
+// Offloads are enabled on each port capable of them, but they are used only if
+// all ports are capable, otherwise they are done in software
 const struct rte_eth_conf default_eth_conf(struct rte_eth_dev_info &dev_info) {
   struct rte_eth_conf ret {};
 
-  // TODO: support software offload
-  CHECK_NE(dev_info.rx_offload_capa & DEV_RX_OFFLOAD_IPV4_CKSUM, 0);
-  CHECK_NE(dev_info.rx_offload_capa & DEV_RX_OFFLOAD_TCP_CKSUM, 0);
-  CHECK_NE(dev_info.rx_offload_capa & DEV_RX_OFFLOAD_VLAN_STRIP, 0);
+  ret.rxmode.offloads = DEV_RX_OFFLOAD_CRC_STRIP;
+
+  bool rx_cksum = (dev_info.rx_offload_capa & DEV_RX_OFFLOAD_IPV4_CKSUM) &&
+                  (dev_info.rx_offload_capa & DEV_RX_OFFLOAD_TCP_CKSUM);
+  if (rx_cksum)
+    ret.rxmode.offloads |= DEV_RX_OFFLOAD_IPV4_CKSUM | DEV_RX_OFFLOAD_TCP_CKSUM;
+  else
+    F_LOG(WARNING) << "rx checksum offload is not supported, do it in software";
+  CONFIG.nic.rx_cksum_offload &= rx_cksum;
+
+  bool vlan_strip = dev_info.rx_offload_capa & DEV_RX_OFFLOAD_VLAN_STRIP;
+  if (vlan_strip)
+    ret.rxmode.offloads |= DEV_RX_OFFLOAD_VLAN_STRIP;
+  else
+    F_LOG(WARNING) << "vlan strip is not supported, do it in software";
+  CONFIG.nic.rx_vlan_strip &= vlan_strip;
+
+  bool qinq_strip =
+      vlan_strip && dev_info.rx_offload_capa & DEV_RX_OFFLOAD_QINQ_STRIP;
+  if (qinq_strip)
+    ret.rxmode.offloads |= DEV_RX_OFFLOAD_QINQ_STRIP;
+  else
+    F_LOG(WARNING) << "qinq strip is not supported, do it in software";
+  CONFIG.nic.rx_qinq_strip &= qinq_strip;
+
+  bool vlan_insert = dev_info.tx_offload_capa & DEV_TX_OFFLOAD_VLAN_INSERT;
+  if (vlan_insert)
+    ret.txmode.offloads |= DEV_TX_OFFLOAD_VLAN_INSERT;
+  else
+    F_LOG(WARNING) << "vlan insert is not supported, do it in software";
+  CONFIG.nic.tx_vlan_insert &= vlan_insert;
+
+  bool qinq_insert =
+      vlan_insert && dev_info.tx_offload_capa & DEV_TX_OFFLOAD_QINQ_INSERT;
+  if (qinq_insert)
+    ret.txmode.offloads |= DEV_TX_OFFLOAD_QINQ_INSERT;
+  else
+    F_LOG(WARNING) << "qinq insert is not supported, do it in software";
+  CONFIG.nic.tx_qinq_insert &= qinq_insert;
+
+  bool tx_cksum = (dev_info.tx_offload_capa & DEV_TX_OFFLOAD_IPV4_CKSUM) &&
+                  (dev_info.tx_offload_capa & DEV_TX_OFFLOAD_TCP_CKSUM);
+  if (CONFIG.nic.tx_cksum_offload && !tx_cksum) {
+    F_LOG(WARNING) << "tx checksum offload is not supported, patch them "
+                      "incrementally in software";
+    CONFIG.nic.tx_cksum_offload = false;
+  }
+
+  if (CONFIG.nic.tx_cksum_offload)
+    ret.txmode.offloads |=
+        (DEV_TX_OFFLOAD_IPV4_CKSUM | DEV_TX_OFFLOAD_TCP_CKSUM);
 
-  CHECK_NE(dev_info.tx_offload_capa & DEV_TX_OFFLOAD_IPV4_CKSUM, 0);
-  CHECK_NE(dev_info.tx_offload_capa & DEV_TX_OFFLOAD_TCP_CKSUM, 0);
+  bool tx_udp_cksum = dev_info.tx_offload_capa & DEV_TX_OFFLOAD_UDP_CKSUM;
+  if (CONFIG.nic.tx_udp_cksum_offload && !(tx_cksum && tx_udp_cksum)) {
+    F_LOG(WARNING) << "tx udp checksum offload is not supported, patch them "
+                      "incrementally in software";
+    CONFIG.nic.tx_udp_cksum_offload = false;
+  }
+
+  if (CONFIG.nic.tx_udp_cksum_offload)
+    ret.txmode.offloads |= DEV_TX_OFFLOAD_UDP_CKSUM;
 
   ret.rxmode.mq_mode = ETH_MQ_RX_RSS;
-  ret.rxmode.offloads = (DEV_RX_OFFLOAD_IPV4_CKSUM | DEV_RX_OFFLOAD_TCP_CKSUM |
-                         DEV_RX_OFFLOAD_CRC_STRIP | DEV_RX_OFFLOAD_VLAN_STRIP);
   ret.rxmode.max_rx_pkt_len = ETHER_MAX_LEN;
   ret.rxmode.ignore_offload_bitfield = 1;
-  ret.txmode.offloads = (DEV_TX_OFFLOAD_IPV4_CKSUM | DEV_TX_OFFLOAD_TCP_CKSUM);
 
   ret.link_speeds = ETH_LINK_SPEED_AUTONEG;
-  ret.rx_adv_conf.rss_conf.rss_hf = ETH_RSS_PROTO_MASK;
+  // Fragments carry no ports, so all packets between two hosts must reach
+  // the same slave for them to follow their connections, at the cost of
+  // spreading connections by hosts only, see 'Config::Frag'.
+  ret.rx_adv_conf.rss_conf.rss_hf =
+      CONFIG.frag.max_datagrams > 0 ? ETH_RSS_IP : ETH_RSS_PROTO_MASK;
 
   //  ret.fdir_conf.mode = RTE_FDIR_MODE_PERFECT;
   //  ret.fdir_conf.mask.ipv4_mask.src_ip = UINT32_MAX;
@@ -34,6 +93,30 @@ const struct rte_eth_conf default_eth_conf(struct rte_eth_dev_info &dev_info) {
   return ret;
 }
 
+// Packets classified by nic are dispatched without parsing their headers
+bool ptype_supported(uint16_t port_id) {
+  constexpr uint32_t mask =
+      RTE_PTYPE_L2_MASK | RTE_PTYPE_L3_MASK | RTE_PTYPE_L4_MASK;
+
+  int num = rte_eth_dev_get_supported_ptypes(port_id, mask, nullptr, 0);
+  if (num <= 0) return false;
+
+  std::vector<uint32_t> ptypes(num);
+  ptypes.resize(std::max(
+      rte_eth_dev_get_supported_ptypes(port_id, mask, ptypes.data(), num), 0));
+
+  bool ether = false, ipv4 = false, tcp = false, frag = false;
+
+  for (auto ptype : ptypes) {
+    ether |= ptype == RTE_PTYPE_L2_ETHER;
+    ipv4 |= ptype == RTE_PTYPE_L3_IPV4;
+    tcp |= ptype == RTE_PTYPE_L4_TCP;
+    frag |= ptype == RTE_PTYPE_L4_FRAG;
+  }
+
+  return ether && ipv4 && tcp && frag;
+}
+
 /*
 void filter_add(uint16_t port_id, const std::string &dst_ip, uint16_t qid) {
   CHECK(!rte_eth_dev_filter_supported(port_id, RTE_ETH_FILTER_NTUPLE));
@@ -53,35 +136,89 @@ void filter_add(uint16_t port_id, const std::string &dst_ip, uint16_t qid) {
 }
  */
 
+// Tags of 'vlan' are matched by their ids from the outer one, 'specs' must
+// hold two of them
+void push_vlan_items(std::vector<rte_flow_item> *pattern, uint32_t vlan,
+                     rte_flow_item_vlan *specs,
+                     const rte_flow_item_vlan *mask) {
+  int num = 0;
+
+  if (headers::OuterVid(vlan) != 0)
+    specs[num++].tci = utils::be16_t(headers::OuterVid(vlan)).raw_value();
+  if (headers::InnerVid(vlan) != 0)
+    specs[num++].tci = utils::be16_t(headers::InnerVid(vlan)).raw_value();
+
+  for (int i = 0; i < num; ++i)
+    pattern->push_back({.type = RTE_FLOW_ITEM_TYPE_VLAN,
+                        .spec = &specs[i],
+                        .last = nullptr,
+                        .mask = mask});
+}
+
 void set_lip_affinity(uint16_t port_id, const utils::be32_t &dst,
-                      uint16_t qid) {
+                      uint32_t vlan, uint16_t qid) {
   F_LOG(INFO) << "set local ip affinity: " << headers::ToIpv4Address(dst)
-              << " to rxq: " << qid;
-
-  //  utils::be32_t dst{};
-  //  headers::ParseIpv4Address(dst_ip, &dst);
+              << " vlan: " << headers::ToVlan(vlan) << " to rxq: " << qid;
 
   rte_flow_attr attr{.group = 0, .priority = 0, .ingress = 1};
 
+  rte_flow_item_vlan tags[2]{};
+  rte_flow_item_vlan tag_mask{};
+  tag_mask.tci = utils::be16_t(headers::Vlan::kVidMask).raw_value();
+
   ipv4_hdr ipv4{};
   ipv4.dst_addr = dst.raw_value();
 
   ipv4_hdr ipv4_mask{};
   ipv4_mask.dst_addr = 0xffffffff;
 
-  rte_flow_item pattern[] = {{.type = RTE_FLOW_ITEM_TYPE_ETH},
-                             {.type = RTE_FLOW_ITEM_TYPE_IPV4,
-                              .spec = &ipv4,
-                              .last = nullptr,
-                              .mask = &ipv4_mask},
-                             {.type = RTE_FLOW_ITEM_TYPE_END}};
+  std::vector<rte_flow_item> pattern{{.type = RTE_FLOW_ITEM_TYPE_ETH}};
+  push_vlan_items(&pattern, vlan, tags, &tag_mask);
+  pattern.push_back({.type = RTE_FLOW_ITEM_TYPE_IPV4,
+                     .spec = &ipv4,
+                     .last = nullptr,
+                     .mask = &ipv4_mask});
+  pattern.push_back({.type = RTE_FLOW_ITEM_TYPE_END});
+
+  rte_flow_action actions[] = {
+      {.type = RTE_FLOW_ACTION_TYPE_QUEUE, .conf = &qid},
+      {.type = RTE_FLOW_ACTION_TYPE_END}};
+
+  CHECK(!rte_flow_validate(port_id, &attr, pattern.data(), actions, nullptr));
+  CHECK(rte_flow_create(port_id, &attr, pattern.data(), actions, nullptr));
+}
+
+void set_lip_affinity(uint16_t port_id, const headers::Ipv6::Address &dst,
+                      uint32_t vlan, uint16_t qid) {
+  F_LOG(INFO) << "set local ip affinity: " << headers::ToIpv6Address(dst)
+              << " vlan: " << headers::ToVlan(vlan) << " to rxq: " << qid;
+
+  rte_flow_attr attr{.group = 0, .priority = 0, .ingress = 1};
+
+  rte_flow_item_vlan tags[2]{};
+  rte_flow_item_vlan tag_mask{};
+  tag_mask.tci = utils::be16_t(headers::Vlan::kVidMask).raw_value();
+
+  ipv6_hdr ipv6{};
+  memcpy(ipv6.dst_addr, dst.bytes, sizeof(ipv6.dst_addr));
+
+  ipv6_hdr ipv6_mask{};
+  memset(ipv6_mask.dst_addr, 0xff, sizeof(ipv6_mask.dst_addr));
+
+  std::vector<rte_flow_item> pattern{{.type = RTE_FLOW_ITEM_TYPE_ETH}};
+  push_vlan_items(&pattern, vlan, tags, &tag_mask);
+  pattern.push_back({.type = RTE_FLOW_ITEM_TYPE_IPV6,
+                     .spec = &ipv6,
+                     .last = nullptr,
+                     .mask = &ipv6_mask});
+  pattern.push_back({.type = RTE_FLOW_ITEM_TYPE_END});
 
   rte_flow_action actions[] = {
       {.type = RTE_FLOW_ACTION_TYPE_QUEUE, .conf = &qid},
       {.type = RTE_FLOW_ACTION_TYPE_END}};
 
-  CHECK(!rte_flow_validate(port_id, &attr, pattern, actions, nullptr));
-  CHECK(rte_flow_create(port_id, &attr, pattern, actions, nullptr));
+  CHECK(!rte_flow_validate(port_id, &attr, pattern.data(), actions, nullptr));
+  CHECK(rte_flow_create(port_id, &attr, pattern.data(), actions, nullptr));
 }
 
 // Find a port attached to DPDK by its PCI address.
@@ -105,6 +242,39 @@ bool find_dpdk_port_by_pci_addr(const std::string &pci, uint16_t *ret_port_id) {
   return false;
 }
 
+// Named by the index of the port in config
+uint16_t create_bond(uint16_t id, const Config::Nic::Port &port,
+                     const std::vector<uint16_t> &members) {
+  bool lacp = port.bond_mode == "lacp";
+
+  int bond = rte_eth_bond_create(
+      utils::Format("net_bonding%hu", id).c_str(),
+      lacp ? BONDING_MODE_8023AD : BONDING_MODE_ACTIVE_BACKUP,
+      port.socket);
+  CHECK_GE(bond, 0);
+
+  for (auto member : members) CHECK(!rte_eth_bond_slave_add(bond, member));
+
+  if (lacp) {
+    // A flow sticks to a member by its tuple, so that it stays in order
+    CHECK(!rte_eth_bond_xmit_policy_set(bond, BALANCE_XMIT_POLICY_LAYER34));
+    // Lacpdu are exchanged on queues of their own if the members support
+    // flow isolation. Otherwise they are handled in the rx and tx bursts of
+    // slaves, which must then call them at least every 100ms (the fast
+    // periodic time of lacp) even when idle, or the members are dropped from
+    // the aggregation.
+    if (rte_eth_bond_8023ad_dedicated_queues_enable(bond) != 0)
+      F_LOG(WARNING) << "dedicated queues of lacp are not supported by "
+                        "members of port: "
+                     << id << ", lacpdu go through the bursts of slaves";
+  }
+
+  F_LOG(INFO) << "bonded device: " << bond << " mode: " << port.bond_mode
+              << " members: " << port.bond_members.size();
+
+  return bond;
+}
+
 void init_driver() {
   uint16_t num_dpdk_ports = rte_eth_dev_count();
 
@@ -144,25 +314,72 @@ void init_driver() {
 
 }  // namespace
 
-PMD::PMD() : Port(), dpdk_port_id_(kDpdkPortUnknown), dev_info_() {
-  CHECK((M::Expose<TS("rx_packets"), TS("rx_bytes"), TS("tx_packets"),
-                   TS("tx_bytes"), TS("tx_dropped")>()));
+const std::vector<std::unique_ptr<PMD>> &PMD::All() {
+  static std::vector<std::unique_ptr<PMD>> ports = [] {
+    CHECK((M::Expose<TS("rx_packets"), TS("rx_bytes"), TS("tx_packets"),
+                     TS("tx_bytes"), TS("tx_dropped")>()));
 
-  init_driver();
+    init_driver();
 
-  uint16_t num_q = CONFIG.slave_cores.size();
+    std::vector<std::unique_ptr<PMD>> ret;
+    for (uint16_t i = 0; i < CONFIG.nic.ports.size(); ++i)
+      ret.emplace_back(std::make_unique<PMD>(i));
 
-  CHECK(find_dpdk_port_by_pci_addr(CONFIG.nic.pci_address, &dpdk_port_id_));
+    return ret;
+  }();
+
+  return ports;
+}
+
+PMD::PMD(uint16_t id)
+    : Port(),
+      id_(id),
+      dpdk_port_id_(kDpdkPortUnknown),
+      dev_info_(),
+      pci_dev_(nullptr) {
+  auto &port = CONFIG.nic.ports[id_];
+  // Each slave sends on the tx queue of its id
+  uint16_t num_txq = CONFIG.slave_cores.size();
+
+  std::vector<uint16_t> members;
+  uint16_t rx_desc = UINT16_MAX;
+  uint16_t tx_desc = UINT16_MAX;
+
+  // A bonded device is virtual, it takes the pci device of the first member
+  // and the least descriptors of all members
+  for (auto &pci : port.bond_members) {
+    uint16_t member;
+    struct rte_eth_dev_info info {};
+
+    CHECK(find_dpdk_port_by_pci_addr(pci, &member));
+    rte_eth_dev_info_get(member, &info);
+
+    if (!pci_dev_) pci_dev_ = info.pci_dev;
+    rx_desc = std::min(rx_desc, info.rx_desc_lim.nb_max);
+    tx_desc = std::min(tx_desc, info.tx_desc_lim.nb_max);
+    members.emplace_back(member);
+  }
+
+  if (members.empty())
+    CHECK(find_dpdk_port_by_pci_addr(port.pci_address, &dpdk_port_id_));
+  else
+    dpdk_port_id_ = create_bond(id_, port, members);
 
   rte_eth_dev_info_get(dpdk_port_id_, &dev_info_);
 
+  if (!pci_dev_) pci_dev_ = dev_info_.pci_dev;
+  rx_desc = std::min(rx_desc, dev_info_.rx_desc_lim.nb_max);
+  tx_desc = std::min(tx_desc, dev_info_.tx_desc_lim.nb_max);
+
+  CHECK_LE(port.rx_queues, dev_info_.max_rx_queues);
+  CHECK_LE(num_txq, dev_info_.max_tx_queues);
+
   struct rte_eth_conf eth_conf = default_eth_conf(dev_info_);
-  CHECK(!rte_eth_dev_configure(dpdk_port_id_, num_q, num_q, &eth_conf));
+  CHECK(!rte_eth_dev_configure(dpdk_port_id_, port.rx_queues, num_txq,
+                               &eth_conf));
 
   rte_eth_promiscuous_enable(dpdk_port_id_);
 
-  int sid = CONFIG.nic.socket;
-
   /* Use defaut rx/tx configuration as provided by PMD ports,
    * maybe need minor tweaks */
 
@@ -174,19 +391,29 @@ PMD::PMD() : Port(), dpdk_port_id_(kDpdkPortUnknown), dev_info_() {
 
   eth_rxconf.offloads = eth_conf.rxmode.offloads;
 
+  // Tx queues are on the socket of the slave using them, since any slave may
+  // send to any port. Rx queues and packets received are on the socket of the
+  // port, which is that of the slaves polling them.
   // TODO: configurable queue size
-  for (auto i : utils::irange(num_q))
-    CHECK(!rte_eth_tx_queue_setup(
-        dpdk_port_id_, i, dev_info_.tx_desc_lim.nb_max, sid, &eth_txconf));
+  for (auto i : utils::irange(num_txq)) {
+    int sid = utils::CoreSocketId(CONFIG.slave_cores[i]).value();
+    CHECK(!rte_eth_tx_queue_setup(dpdk_port_id_, i, tx_desc, sid,
+                                  &eth_txconf));
+  }
 
-  for (auto i : utils::irange(num_q))
-    CHECK(!rte_eth_rx_queue_setup(
-        dpdk_port_id_, i, dev_info_.rx_desc_lim.nb_max, sid, &eth_rxconf,
-        utils::Singleton<PacketPool>::instance().pool()));
+  for (auto i : utils::irange(port.rx_queues))
+    CHECK(!rte_eth_rx_queue_setup(dpdk_port_id_, i, rx_desc, port.socket,
+                                  &eth_rxconf,
+                                  PacketPool::Of(port.socket).pool()));
 
   //  CHECK(!rte_eth_dev_set_vlan_offload(dpdk_port_id_,
   //  ETH_VLAN_STRIP_OFFLOAD));
 
+  if (!ptype_supported(dpdk_port_id_)) {
+    F_LOG(WARNING) << "packet type is not classified, parse it in software";
+    CONFIG.nic.rx_ptype = false;
+  }
+
   CHECK(!rte_flow_flush(dpdk_port_id_, nullptr));
 
   //  for (auto i : utils::irange(CONFIG.nic.local_ips.size())) {
@@ -194,17 +421,34 @@ PMD::PMD() : Port(), dpdk_port_id_(kDpdkPortUnknown), dev_info_() {
   //                     i % CONFIG.slave_cores.size());
   //  }
 
-  for (auto &pair : CONFIG.slave_local_ips)
-    set_lip_affinity(dpdk_port_id_, pair.second, pair.first);
+  // Only for the local ips on this port, scoped by their vlans. Those of a
+  // bonded device are set on every member by the bonding driver, which also
+  // shares the rss key between them, so that a flow is still received by the
+  // same slave after failover. They are only given to the slaves of the port.
+  for (auto &pair : CONFIG.slave_local_ips) {
+    auto &link = CONFIG.local_ip_links.at(pair.second);
+    uint16_t qid;
+    if (link.port == id_ && queue_of(pair.first, &qid))
+      set_lip_affinity(dpdk_port_id_, pair.second, link.vlan, qid);
+  }
+
+  for (auto &pair : CONFIG.slave_local_ips6) {
+    auto &link = CONFIG.local_ip6_links.at(pair.second);
+    uint16_t qid;
+    if (link.port == id_ && queue_of(pair.first, &qid))
+      set_lip_affinity(dpdk_port_id_, pair.second, link.vlan, qid);
+  }
 
   CHECK(!rte_eth_dev_start(dpdk_port_id_));
   CHECK_NE(dpdk_port_id_, kDpdkPortUnknown);
 
+  init_reta();
+
   rte_eth_macaddr_get(dpdk_port_id_,
                       reinterpret_cast<ether_addr *>(conf_.addr.bytes));
 
   // TODO: do it in Config::validate
-  CONFIG.nic.mac_address = conf_.addr;
+  port.mac_address = conf_.addr;
 
   CHECK(!rte_eth_dev_set_mtu(dpdk_port_id_, CONFIG.nic.mtu));
 
@@ -217,7 +461,8 @@ PMD::PMD() : Port(), dpdk_port_id_(kDpdkPortUnknown), dev_info_() {
   // Call the blocking version update cache once
   rte_eth_link_get(dpdk_port_id_, &dpdk_status);
 
-  F_LOG(INFO) << "initialize successful, speed: " << dpdk_status.link_speed
+  F_LOG(INFO) << "initialize successful, port: " << id_
+              << " speed: " << dpdk_status.link_speed
               << " full-duplex: " << dpdk_status.link_duplex
               << " auto-neg: " << dpdk_status.link_autoneg
               << " up: " << dpdk_status.link_status;
@@ -228,6 +473,136 @@ PMD::~PMD() {
   rte_eth_dev_stop(dpdk_port_id_);
 }
 
+void PMD::init_reta() {
+  uint16_t size = dev_info_.reta_size;
+  std::vector<struct rte_eth_rss_reta_entry64> reta(
+      (size + RTE_RETA_GROUP_SIZE - 1) / RTE_RETA_GROUP_SIZE);
+
+  for (auto &entry : reta) entry.mask = UINT64_MAX;
+
+  if (size == 0 ||
+      rte_eth_dev_rss_reta_query(dpdk_port_id_, reta.data(), size) != 0) {
+    F_LOG(WARNING) << "redirection table is not supported by port: " << id_
+                   << ", slaves of it can not be parked";
+    return;
+  }
+
+  for (uint16_t i = 0; i < size; ++i)
+    home_reta_.emplace_back(
+        reta[i / RTE_RETA_GROUP_SIZE].reta[i % RTE_RETA_GROUP_SIZE]);
+
+  lent_.reset(new Lent[size]);
+}
+
+bool PMD::UpdateReta() {
+  uint16_t size = home_reta_.size();
+  if (size == 0) return false;
+
+  std::vector<struct rte_eth_rss_reta_entry64> reta(
+      (size + RTE_RETA_GROUP_SIZE - 1) / RTE_RETA_GROUP_SIZE);
+
+  for (auto &entry : reta) entry.mask = UINT64_MAX;
+
+  if (rte_eth_dev_rss_reta_query(dpdk_port_id_, reta.data(), size) != 0) {
+    F_LOG(ERROR) << "failed to query reta of port: " << id_;
+    return false;
+  }
+
+  for (auto &entry : reta) entry.mask = 0;
+
+  auto active = [this](uint16_t qid) {
+    return Worker::state(slave_of(qid)) == Worker::Active;
+  };
+
+  uint64_t now = utils::Rdtsc();
+  uint16_t moved = 0;
+
+  // Connections of the bucket are left to the slave serving it now
+  auto move = [&](uint16_t i, uint16_t qid) {
+    auto &entry = reta[i / RTE_RETA_GROUP_SIZE];
+    auto &lent = lent_[i];
+
+    lent.last.store(now, std::memory_order_relaxed);
+    lent.slave.store(slave_of(entry.reta[i % RTE_RETA_GROUP_SIZE]),
+                     std::memory_order_release);
+
+    entry.mask |= uint64_t(1) << (i % RTE_RETA_GROUP_SIZE);
+    entry.reta[i % RTE_RETA_GROUP_SIZE] = qid;
+    ++moved;
+  };
+
+  // Buckets on each rx queue after the update
+  std::vector<uint16_t> loads(rx_queues());
+  std::vector<uint16_t> orphans;
+
+  for (uint16_t i = 0; i < size; ++i) {
+    uint16_t home = home_reta_[i];
+    uint16_t qid = reta[i / RTE_RETA_GROUP_SIZE].reta[i % RTE_RETA_GROUP_SIZE];
+
+    if (active(home)) {
+      if (qid != home) move(i, home);
+      ++loads[home];
+    } else if (active(qid)) {
+      ++loads[qid];
+    } else {
+      orphans.emplace_back(i);
+    }
+  }
+
+  for (auto i : orphans) {
+    uint16_t least = kNoSlave;
+
+    for (uint16_t qid = 0; qid < rx_queues(); ++qid)
+      if (active(qid) && (least == kNoSlave || loads[qid] < loads[least]))
+        least = qid;
+
+    // Never since the slave of the first queue is not parked
+    if (unlikely(least == kNoSlave)) {
+      F_LOG(ERROR) << "no active slave of port: " << id_;
+      return false;
+    }
+
+    move(i, least);
+    ++loads[least];
+  }
+
+  if (moved == 0) return true;
+
+  if (rte_eth_dev_rss_reta_update(dpdk_port_id_, reta.data(), size) != 0) {
+    F_LOG(ERROR) << "failed to update reta of port: " << id_;
+    return false;
+  }
+
+  F_LOG(INFO) << "port: " << id_ << " moved " << moved << " of " << size
+              << " buckets of reta";
+  return true;
+}
+
+int PMD::Lender(uint32_t hash, uint64_t idle) const {
+  if (home_reta_.empty()) return -1;
+
+  auto &lent = lent_[hash % home_reta_.size()];
+  uint16_t slave = lent.slave.load(std::memory_order_acquire);
+  if (slave == kNoSlave) return -1;
+
+  switch (Worker::state(slave)) {
+    case Worker::Draining:
+      return slave;
+    case Worker::Active:
+      return lent.last.load(std::memory_order_relaxed) + idle > W_TSC ? slave
+                                                                      : -1;
+    default:
+      return -1;
+  }
+}
+
+void PMD::KeepLent(uint32_t hash) {
+  if (home_reta_.empty()) return;
+
+  lent_[hash % home_reta_.size()].last.store(W_TSC,
+                                             std::memory_order_relaxed);
+}
+
 struct Port::Status PMD::Status() {
   struct rte_eth_link dpdk_status {};
   // rte_eth_link_get() may block up to 9 seconds, so use _nowait() variant.
@@ -265,7 +640,10 @@ uint16_t PMD::Recv(uint16_t qid, Packet **pkts, uint16_t cnt) {
     M::Adder<TS("rx_packets")>() << recv;
 
     uint64_t bytes = 0;
-    for (auto i : utils::irange(recv)) bytes += pkts[i]->data_len();
+    for (auto i : utils::irange(recv)) {
+      bytes += pkts[i]->data_len();
+      pkts[i]->set_port(id_);
+    }
 
     M::Adder<TS("rx_bytes")>() << bytes;
   }
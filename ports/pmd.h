@@ -4,27 +4,85 @@
 
 namespace xlb::ports {
 
-// This driver binds a port to a device using DPDK.
+// This driver binds a port to a device using DPDK. There is one for each port
+// in config, identified by its index there.
 class PMD final : public Port {
 public:
   static const uint16_t kDpdkPortUnknown = RTE_MAX_ETHPORTS;
 
-  PMD();
+  explicit PMD(uint16_t id);
   ~PMD() override;
 
+  // All of them in the order of config, bound on the first call
+  static const std::vector<std::unique_ptr<PMD>> &All();
+
   inline uint16_t Recv(uint16_t qid, Packet **pkts, uint16_t cnt) override;
   inline uint16_t Send(uint16_t qid, Packet **pkts, uint16_t cnt) override;
 
   struct Status Status() override;
 
   const struct rte_eth_dev_info *dev_info() { return &dev_info_; }
+  // Of the first member if it is a bonded device
+  const struct rte_pci_device *pci_dev() { return pci_dev_; }
   uint16_t dpdk_port_id() { return dpdk_port_id_; }
+  uint16_t id() const { return id_; }
+
+  // All on the socket of the port, each polled by one of the slaves there in
+  // turn. The one at the position of a slave is always its own, where flows
+  // to its local ips are steered, and the redirection table only covers them.
+  uint16_t rx_queues() const { return CONFIG.nic.ports[id_].rx_queues; }
+
+  uint16_t slave_of(uint16_t qid) const {
+    auto &slaves = CONFIG.nic.ports[id_].slaves;
+    return slaves[qid % slaves.size()];
+  }
+
+  // Return false if 'wid' is not on the socket of the port
+  bool queue_of(uint16_t wid, uint16_t *qid) const {
+    auto &slaves = CONFIG.nic.ports[id_].slaves;
+    auto it = std::find(slaves.begin(), slaves.end(), wid);
+    if (it == slaves.end()) return false;
+
+    *qid = it - slaves.begin();
+    return true;
+  }
+
+  // Move the buckets of the redirection table on the rx queues of slaves not
+  // active to the least loaded active ones, and give back those taken from
+  // active slaves, the others stay where they are. Return false if the
+  // redirection table can not be updated.
+  bool UpdateReta();
+
+  // The slave that served the bucket of 'hash' before it was moved, while it
+  // is draining or has kept a connection in the bucket within 'idle' cycles,
+  // which may still own the connection of a packet missed. -1 if there is
+  // none.
+  int Lender(uint32_t hash, uint64_t idle) const;
+  // Called by the lender for each packet of a connection in the bucket
+  void KeepLent(uint32_t hash);
 
 private:
+  static constexpr uint16_t kNoSlave = UINT16_MAX;
+
+  struct Lent {
+    std::atomic<uint16_t> slave{kNoSlave};
+    // Tsc of the last packet of the lender in the bucket
+    std::atomic<uint64_t> last{0};
+  };
+
+  void init_reta();
+
+  // Counted for all ports together
   using M = utils::Metric<TS("xlb_ports"), TS("pmd")>;
+  uint16_t id_;
   // The DPDK port ID number (set after binding).
   uint16_t dpdk_port_id_;
   struct rte_eth_dev_info dev_info_;
+  struct rte_pci_device *pci_dev_;
+  // Queues of the buckets when all slaves are active, empty if the
+  // redirection table is not supported
+  std::vector<uint16_t> home_reta_;
+  std::unique_ptr<Lent[]> lent_;
 };
 
 }  // namespace xlb::ports
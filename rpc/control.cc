@@ -8,13 +8,21 @@
 
 #include "runtime/config.h"
 #include "runtime/exec.h"
+#include "runtime/worker.h"
 
 #include "headers/ip.h"
+#include "headers/ipv6.h"
+#include "headers/tcp.h"
+#include "headers/udp.h"
 
 #include "conntrack/metric.h"
 #include "conntrack/table.h"
 #include "conntrack/tuple.h"
 
+#include "modules/route.h"
+
+#include "ports/pmd.h"
+
 #include "utils/boost.h"
 #include "utils/channel.h"
 #include "utils/common.h"
@@ -22,9 +30,21 @@
 
 namespace xlb::rpc {
 
+using conntrack::BasicTuple2;
 using conntrack::SvcMetrics;
-using conntrack::Tuple2;
+using headers::Ethernet;
+using headers::Ipv4;
+using headers::Ipv6;
+using headers::Tcp;
+using headers::Toa;
+using headers::Udp;
+using headers::is_ipv4_v;
+using headers::ParseIpAddress;
 using headers::ParseIpv4Address;
+using headers::ParseVlan;
+using headers::ToIpAddress;
+using headers::ToIpv4Address;
+using headers::ToVlan;
 using utils::any_of_equal;
 using utils::be16_t;
 using utils::be32_t;
@@ -49,10 +69,63 @@ void make_ok(T *resp) {
   resp->mutable_error()->set_errmsg("");
 }
 
-std::pair<bool, Tuple2> validate_service(const Service &svc, Error *err) {
+// Services in ipv6 are told by the colons
+bool is_ipv6(const Service &svc) {
+  return svc.addr().find(':') != std::string::npos;
+}
+
+conntrack::Protocol protocol_of(const Service &svc) {
+  return svc.protocol() == UDP ? conntrack::Protocol::kUdp
+                               : conntrack::Protocol::kTcp;
+}
+
+conntrack::Forward forward_of(Forward forward) {
+  switch (forward) {
+    case DR:
+      return conntrack::Forward::kDr;
+    case IPIP:
+      return conntrack::Forward::kIpip;
+    case GUE:
+      return conntrack::Forward::kGue;
+    default:
+      return conntrack::Forward::kFullNat;
+  }
+}
+
+// The largest mss that keeps the segments of both sides in the mtu after the
+// overhead added by 'forward'
+template <typename Addr>
+uint16_t default_mss(conntrack::Forward forward) {
+  size_t overhead =
+      (is_ipv4_v<Addr> ? sizeof(Ipv4) : sizeof(Ipv6)) + sizeof(Tcp);
+
+  switch (forward) {
+    case conntrack::Forward::kFullNat:
+      // Toa is only for ipv4
+      if (is_ipv4_v<Addr>) overhead += sizeof(Toa);
+      break;
+    case conntrack::Forward::kIpip:
+      overhead += sizeof(Ipv4);
+      break;
+    case conntrack::Forward::kGue:
+      overhead += sizeof(Ipv4) + sizeof(Udp);
+      break;
+    default:
+      break;
+  }
+
+  return CONFIG.nic.mtu - overhead;
+}
+
+template <typename Addr>
+std::pair<bool, BasicTuple2<Addr>> validate_service(const Service &svc,
+                                                    Error *err) {
   std::stringstream ss;
 
-  if (any_of_equal(CONFIG.nic.local_ips, svc.addr()) ||
+  if (std::any_of(CONFIG.nic.ports.begin(), CONFIG.nic.ports.end(),
+                  [&svc](auto &port) {
+                    return any_of_equal(port.local_ips, svc.addr());
+                  }) ||
       CONFIG.kni.ip_address == svc.addr()) {
     ss << "forbidden service ip: " << svc.addr();
     goto FAILED;
@@ -63,9 +136,30 @@ std::pair<bool, Tuple2> validate_service(const Service &svc, Error *err) {
     goto FAILED;
   }
 
-  Tuple2 tuple;
+  if (!is_ipv4_v<Addr> && CONFIG.svc.max_ipv6_conn == 0) {
+    ss << "ipv6 is disabled: " << svc.addr();
+    goto FAILED;
+  }
 
-  if (!ParseIpv4Address(svc.addr(), &tuple.ip)) {
+  // Otherwise the next hop of replies is unknown
+  if (!is_ipv4_v<Addr> && CONFIG.route.ipv6_gateway.empty()) {
+    ss << "no ipv6 gateway is configured: " << svc.addr();
+    goto FAILED;
+  }
+
+  if (svc.protocol() == UDP && CONFIG.udp.max_flows == 0) {
+    ss << "udp is disabled: " << svc.addr();
+    goto FAILED;
+  }
+
+  if (svc.protocol() == UDP && !is_ipv4_v<Addr>) {
+    ss << "udp is not supported in ipv6: " << svc.addr();
+    goto FAILED;
+  }
+
+  BasicTuple2<Addr> tuple;
+
+  if (!ParseIpAddress(svc.addr(), &tuple.ip)) {
     ss << "invalid service ip: " << svc.addr();
     goto FAILED;
   }
@@ -82,59 +176,262 @@ FAILED:
   return {false, {}};
 }
 
+// Gateways are not checked when the route is to be deleted
+bool validate_route(const Route &route, bool with_gateways, be32_t *prefix,
+                    uint8_t *depth, std::vector<be32_t> *gateways,
+                    uint16_t *port, uint32_t *vlan, Error *err) {
+  std::stringstream ss;
+  auto pos = route.prefix().find('/');
+  int len = -1;
+
+  if (pos != std::string::npos) {
+    try {
+      len = std::stoi(route.prefix().substr(pos + 1));
+    } catch (const std::exception &) {
+    }
+  }
+
+  if (len < 0 || len > 32 ||
+      !ParseIpv4Address(route.prefix().substr(0, pos), prefix)) {
+    ss << "invalid route prefix: " << route.prefix();
+    goto FAILED;
+  }
+
+  *depth = len;
+
+  if (!with_gateways) return true;
+
+  if (route.gateways().empty() ||
+      size_t(route.gateways_size()) > modules::Routes::kMaxPaths) {
+    ss << "number of gateways must be in 1.." << modules::Routes::kMaxPaths;
+    goto FAILED;
+  }
+
+  for (auto &str : route.gateways()) {
+    be32_t gateway;
+
+    if (!ParseIpv4Address(str, &gateway)) {
+      ss << "invalid gateway: " << str;
+      goto FAILED;
+    }
+
+    gateways->emplace_back(gateway);
+  }
+
+  if (route.port() >= CONFIG.nic.ports.size()) {
+    ss << "invalid port: " << route.port();
+    goto FAILED;
+  }
+
+  *port = route.port();
+
+  *vlan = 0;
+  if (route.has_vlan() && !ParseVlan(route.vlan(), vlan)) {
+    ss << "invalid vlan: " << route.vlan();
+    goto FAILED;
+  }
+
+  return true;
+
+FAILED:
+  auto str = ss.str();
+  F_LOG(ERROR) << str;
+  err->set_code(-1);
+  err->set_errmsg(str);
+  return false;
+}
+
+bool validate_slaves(const SlavesRequest &request, bool park,
+                     std::vector<uint16_t> *ids, Error *err) {
+  std::stringstream ss;
+
+  if (request.ids().empty()) {
+    ss << "no slave is specified";
+    goto FAILED;
+  }
+
+  for (auto id : request.ids()) {
+    if (id >= CONFIG.slave_cores.size() || (park && !Worker::Parkable(id))) {
+      ss << "invalid slave: " << id;
+      goto FAILED;
+    }
+    ids->emplace_back(id);
+  }
+
+  return true;
+
+FAILED:
+  auto str = ss.str();
+  F_LOG(ERROR) << str;
+  err->set_code(-1);
+  err->set_errmsg(str);
+  return false;
+}
+
+// Should only be called in the trivial
+bool update_reta() {
+  bool ret = true;
+  for (auto &port : ports::PMD::All()) ret &= port->UpdateReta();
+  return ret;
+}
+
 void trivial_done(Closure *done) {
   Exec::InTrivial([done]() { brpc::ClosureGuard done_guard(done); });
 }
 
-}  // namespace
-
-void ControlImpl::AddVirtualService(RpcController *controller,
-                                    const VirtualServiceRequest *request,
-                                    GeneralResponse *response, Closure *done) {
+template <typename Addr>
+void add_virtual_service(const VirtualServiceRequest *request,
+                         GeneralResponse *response, Closure *done) {
   brpc::ClosureGuard done_guard(done);
 
-  auto pair = validate_service(request->svc(), response->mutable_error());
+  auto pair = validate_service<Addr>(request->svc(), response->mutable_error());
   if (!pair.first) return;
 
+  if (request->slow_start() > UINT16_MAX) {
+    make_error(response, "invalid slow start");
+    return;
+  }
+
+  if (!is_ipv4_v<Addr> && request->persist_timeout() > 0) {
+    make_error(response, "persistence is not supported in ipv6");
+    return;
+  }
+
+  auto protocol = protocol_of(request->svc());
+
+  if (protocol == conntrack::Protocol::kUdp && request->persist_timeout() > 0) {
+    make_error(response, "persistence is not supported for udp");
+    return;
+  }
+
+  if (request->quic_server_id_len() > sizeof(uint64_t) ||
+      (request->quic_server_id_len() > 0 &&
+       protocol != conntrack::Protocol::kUdp)) {
+    make_error(response, "invalid quic server id length");
+    return;
+  }
+
+  auto forward = forward_of(request->forward());
+
+  if (forward != conntrack::Forward::kFullNat &&
+      (protocol != conntrack::Protocol::kTcp || request->has_overflow())) {
+    make_error(response, "only full-nat is supported for udp or overflow");
+    return;
+  }
+
+  if (!is_ipv4_v<Addr> && (forward == conntrack::Forward::kIpip ||
+                           forward == conntrack::Forward::kGue)) {
+    make_error(response, "tunnel is not supported in ipv6");
+    return;
+  }
+
+  // The minimum of ipv4 in RFC 879
+  if (request->mss() > UINT16_MAX ||
+      (request->mss() > 0 && request->mss() < 536)) {
+    make_error(response, "invalid mss");
+    return;
+  }
+
+  uint16_t mss = request->mss() ? request->mss() : default_mss<Addr>(forward);
+
+  uint32_t vlan = 0;
+  if (request->has_vlan() && !ParseVlan(request->vlan(), &vlan)) {
+    make_error(response, "invalid vlan");
+    return;
+  }
+
+  std::optional<BasicTuple2<Addr>> overflow;
+  if (request->has_overflow()) {
+    if (is_ipv6(request->overflow()) != is_ipv6(request->svc())) {
+      make_error(response, "overflow must be in the same address family");
+      return;
+    }
+
+    auto opair =
+        validate_service<Addr>(request->overflow(), response->mutable_error());
+    if (!opair.first) return;
+
+    if (opair.second == pair.second) {
+      make_error(response, "overflow can not be the virtual service itself");
+      return;
+    }
+
+    overflow = opair.second;
+  }
+
+  auto selector = request->scheduler() == LATENCY
+                      ? conntrack::Selector::kLatency
+                      : conntrack::Selector::kHash;
+  auto ramp = request->ramp() == EXPONENTIAL ? conntrack::Ramp::kExponential
+                                             : conntrack::Ramp::kLinear;
+  uint16_t slow_start = request->slow_start();
+
   done_guard.release();
 
-  Exec::InTrivial([tuple = pair.second, response, done]() {
+  Exec::InTrivial([tuple = pair.second, protocol, forward, mss, vlan, selector,
+                   ramp, slow_start, overflow,
+                   persist_timeout = request->persist_timeout(),
+                   quic_len = request->quic_server_id_len(), response,
+                   done]() {
     brpc::ClosureGuard done_guard(done);
 
-    if (STABLE.FindRs(tuple)) {
+    if (STABLE_OF(Addr).FindRs(tuple)) {
       make_error(response, "recursion is not allowed");
       return;
     }
 
-    auto vs = STABLE.FindVs(tuple);
+    auto vs = STABLE_OF(Addr).FindVs(tuple, protocol);
     if (vs) {
       make_warn(response, "virtual service already exists");
       return;
     }
 
-    if (STABLE.CountVs() >= CONFIG.svc.max_virtual_service) {
+    if (STABLE_OF(Addr).CountVs() >= CONFIG.svc.max_virtual_service) {
       make_error(response, "number of virtual service exceeds the limit");
       return;
     }
 
-    vs = STABLE.AddVs(tuple);
+    if (STABLE_OF(Addr).VlanConflicts(tuple.ip, vlan)) {
+      make_error(response, "virtual service ip is in another vlan");
+      return;
+    }
+
+    vs = STABLE_OF(Addr).AddVs(tuple, protocol, vlan);
 
     if (!vs) {
-      make_error(response, STABLE.LastError());
+      make_error(response, STABLE_OF(Addr).LastError());
       return;
     }
 
     auto metric = SvcMetrics::Get();
     // Just in case
-    if (!metric->Expose("virt", tuple)) {
-      STABLE.RemoveVs(vs);
+    auto type = protocol == conntrack::Protocol::kUdp ? "virt_udp" : "virt";
+    if (!metric->Expose(type, tuple)) {
+      STABLE_OF(Addr).RemoveVs(vs);
       make_error(response, "failed to expose metrics");
       return;
     }
     vs->set_metrics(metric);
-
-    Exec::InSlaves(
-        [tuple, metric]() { STABLE.AddVs(tuple)->set_metrics(metric); });
+    vs->set_selector(selector);
+    vs->set_slow_start(slow_start, ramp);
+    if (overflow) vs->set_overflow(*overflow);
+    vs->set_persist_timeout(persist_timeout);
+    vs->set_quic_server_id_len(quic_len);
+    vs->set_forward(forward);
+    vs->set_mss(mss);
+
+    Exec::InSlaves([tuple, protocol, forward, mss, vlan, metric, selector,
+                    ramp, slow_start, overflow, persist_timeout, quic_len]() {
+      auto vs = STABLE_OF(Addr).AddVs(tuple, protocol, vlan);
+      vs->set_forward(forward);
+      vs->set_mss(mss);
+      vs->set_metrics(metric);
+      vs->set_selector(selector);
+      vs->set_slow_start(slow_start, ramp);
+      if (overflow) vs->set_overflow(*overflow);
+      vs->set_persist_timeout(persist_timeout);
+      vs->set_quic_server_id_len(quic_len);
+    });
 
     make_ok(response);
     done_guard.release();
@@ -142,20 +439,21 @@ void ControlImpl::AddVirtualService(RpcController *controller,
   });
 }
 
-void ControlImpl::DelVirtualService(RpcController *controller,
-                                    const VirtualServiceRequest *request,
-                                    GeneralResponse *response, Closure *done) {
+template <typename Addr>
+void del_virtual_service(const VirtualServiceRequest *request,
+                         GeneralResponse *response, Closure *done) {
   brpc::ClosureGuard done_guard(done);
 
-  auto pair = validate_service(request->svc(), response->mutable_error());
+  auto pair = validate_service<Addr>(request->svc(), response->mutable_error());
   if (!pair.first) return;
 
   done_guard.release();
 
-  Exec::InTrivial([tuple = pair.second, response, done]() {
+  Exec::InTrivial([tuple = pair.second,
+                   protocol = protocol_of(request->svc()), response, done]() {
     brpc::ClosureGuard done_guard(done);
 
-    auto vs = STABLE.FindVs(tuple);
+    auto vs = STABLE_OF(Addr).FindVs(tuple, protocol);
     if (!vs) {
       make_warn(response, "virtual service does not exist");
       return;
@@ -163,9 +461,11 @@ void ControlImpl::DelVirtualService(RpcController *controller,
 
     // vs->metrics()->Hide();
     // STABLE.ForeachRs(vs, [](auto *rs) { rs->metrics()->Hide(); });
-    STABLE.RemoveVs(vs);
+    STABLE_OF(Addr).RemoveVs(vs);
 
-    Exec::InSlaves([tuple]() { STABLE.RemoveVs(STABLE.FindVs(tuple)); });
+    Exec::InSlaves([tuple, protocol]() {
+      STABLE_OF(Addr).RemoveVs(STABLE_OF(Addr).FindVs(tuple, protocol));
+    });
 
     make_ok(response);
     done_guard.release();
@@ -173,83 +473,109 @@ void ControlImpl::DelVirtualService(RpcController *controller,
   });
 }
 
-void ControlImpl::ListVirtualService(RpcController *controller,
-                                     const EmptyRequest *request,
-                                     ServicesResponse *response,
-                                     Closure *done) {
+template <typename Addr>
+void attach_real_service(const RealServiceRequest *request,
+                         GeneralResponse *response, Closure *done) {
   brpc::ClosureGuard done_guard(done);
 
-  done_guard.release();
+  if (is_ipv6(request->real()) != is_ipv6(request->virt())) {
+    make_error(response, "real service must be in the same address family");
+    return;
+  }
 
-  Exec::InTrivial([response, done]() {
-    brpc::ClosureGuard done_guard(done);
+  auto vpair =
+      validate_service<Addr>(request->virt(), response->mutable_error());
+  if (!vpair.first) return;
+  auto rpair =
+      validate_service<Addr>(request->real(), response->mutable_error());
+  if (!rpair.first) return;
 
-    STABLE.ForeachVs([response](auto *vs) {
-      auto *resp_vs = response->add_list();
-      resp_vs->set_addr(ToIpv4Address(vs->tuple().ip));
-      resp_vs->set_port(vs->tuple().port.value());
-    });
+  if (vpair.second == rpair.second) {
+    make_error(response, "real service and virtual service can not be same");
+    return;
+  }
 
-    if (response->list().empty()) {
-      make_warn(response, "there is no virtual service");
+  if (request->weight() == 0 || request->weight() > UINT16_MAX) {
+    make_error(response, "invalid weight");
+    return;
+  }
+
+  std::optional<Ethernet::Address> hw_addr;
+  if (request->has_mac_address()) {
+    hw_addr.emplace();
+    if (!hw_addr->FromString(request->mac_address()) || hw_addr->IsZero() ||
+        hw_addr->IsBroadcast()) {
+      make_error(response, "invalid mac address");
       return;
     }
+  }
 
-    make_ok(response);
-    done_guard.release();
-    trivial_done(done);
-  });
-}
-
-void ControlImpl::AttachRealService(RpcController *controller,
-                                    const RealServiceRequest *request,
-                                    GeneralResponse *response, Closure *done) {
-  brpc::ClosureGuard done_guard(done);
+  std::optional<Config::Link> link;
+  if (request->has_port() || request->has_vlan()) {
+    link.emplace(Config::Link{uint16_t(request->port()), 0});
 
-  auto vpair = validate_service(request->virt(), response->mutable_error());
-  if (!vpair.first) return;
-  auto rpair = validate_service(request->real(), response->mutable_error());
-  if (!rpair.first) return;
+    if (!hw_addr || request->port() >= CONFIG.nic.ports.size()) {
+      make_error(response, "invalid port");
+      return;
+    }
 
-  if (vpair.second == rpair.second) {
-    make_error(response, "real service and virtual service can not be same");
-    return;
+    if (request->has_vlan() && !ParseVlan(request->vlan(), &link->vlan)) {
+      make_error(response, "invalid vlan");
+      return;
+    }
   }
 
   done_guard.release();
 
   Exec::InTrivial(
-      [vtuple = vpair.second, rtuple = rpair.second, response, done]() {
+      [vtuple = vpair.second, rtuple = rpair.second,
+       protocol = protocol_of(request->virt()), weight = request->weight(),
+       max_conns = request->max_conns(),
+       server_id = request->quic_server_id(), hw_addr, link, response,
+       done]() mutable {
         brpc::ClosureGuard done_guard(done);
 
-        if (STABLE.FindVs(rtuple)) {
+        if (STABLE_OF(Addr).FindVs(rtuple, protocol)) {
           make_error(response, "recursion is not allowed");
           return;
         }
 
-        auto vs = STABLE.FindVs(vtuple);
+        auto vs = STABLE_OF(Addr).FindVs(vtuple, protocol);
         if (!vs) {
           make_error(response, "virtual service does not exist");
           return;
         }
 
-        auto rs = STABLE.FindRs(rtuple);
+        if (server_id != 0) {
+          auto len = vs->quic_server_id_len();
+          if (len == 0 || (len < sizeof(uint64_t) && server_id >> len * 8)) {
+            make_error(response, "invalid quic server id");
+            return;
+          }
+
+          if (vs->FindRs(server_id)) {
+            make_error(response, "quic server id has been used");
+            return;
+          }
+        }
+
+        auto rs = STABLE_OF(Addr).FindRs(rtuple);
         if (rs) {
           // In the master, the existence of rs means that there must be a vs
           // reference to it
-          auto pair = STABLE.RsAttached(vs, rs);
+          auto pair = STABLE_OF(Addr).RsAttached(vs, rs);
           if (pair.first) {
             make_warn(response, "real service has attached");
             return;
           }
         } else {
-          if (STABLE.CountRs() >= CONFIG.svc.max_real_service) {
+          if (STABLE_OF(Addr).CountRs() >= CONFIG.svc.max_real_service) {
             make_error(response, "number of real service exceeds the limit");
             return;
           }
           // If the 'AttachRs' is not called, rs will destroy at the end of the
           // closure
-          rs = STABLE.AddRs(rtuple);
+          rs = STABLE_OF(Addr).AddRs(rtuple);
           auto metric = SvcMetrics::Get();
           // Just in case
           if (!metric->Expose("real", rtuple)) {
@@ -260,18 +586,57 @@ void ControlImpl::AttachRealService(RpcController *controller,
           rs->set_metrics(metric);
         }
 
-        if (STABLE.CountRs(vs) >= CONFIG.svc.max_real_per_virtual) {
+        // Packets are passed to rs without rewriting
+        if (vs->forward() != conntrack::Forward::kFullNat &&
+            rtuple.port != vtuple.port) {
+          make_error(response, "port must be the same unless full-nat");
+          return;
+        }
+
+        if (vs->forward() == conntrack::Forward::kDr && !hw_addr &&
+            rs->hw_addr().IsZero()) {
+          make_error(response, "mac address is required in DR mode");
+          return;
+        }
+
+        // Frames in DR mode leave from where rs is rather than where the
+        // clients are
+        if (hw_addr && !link) {
+          Config::Link found{};
+          if constexpr (is_ipv4_v<Addr>)
+            if (ROUTES.OnLink(rtuple.ip, &found.port, &found.vlan))
+              link = found;
+
+          if (!link) {
+            make_error(response, "real service is not on the local segment "
+                                 "of any route, port is required");
+            return;
+          }
+        }
+
+        if (STABLE_OF(Addr).CountRs(vs) >= CONFIG.svc.max_real_per_virtual) {
           make_error(
               response,
               "number of real service per virtual service exceeds the limit");
           return;
         }
 
-        STABLE.AttachRs(vs, rs);
-
-        Exec::InSlaves([vtuple, rtuple, metric = rs->metrics()]() {
-          STABLE.AttachRs(STABLE.FindVs(vtuple), STABLE.AddRs(rtuple))
-              ->set_metrics(metric);
+        STABLE_OF(Addr).AttachRs(vs, rs, weight, server_id);
+        // The latest one takes effect for rs attached to multiple vs
+        rs->set_max_conns(max_conns);
+        if (hw_addr) rs->set_hw_addr(*hw_addr, link->port, link->vlan);
+
+        Exec::InSlaves([vtuple, rtuple, protocol, weight, max_conns, server_id,
+                        metric = rs->metrics(), ejected = rs->ejected(),
+                        hw_addr = rs->hw_addr(), port = rs->port(),
+                        vlan = rs->vlan()]() {
+          auto rs = STABLE_OF(Addr).AttachRs(
+              STABLE_OF(Addr).FindVs(vtuple, protocol),
+              STABLE_OF(Addr).AddRs(rtuple), weight, server_id);
+          rs->set_metrics(metric);
+          rs->set_ejected(ejected);
+          rs->set_max_conns(max_conns);
+          rs->set_hw_addr(hw_addr, port, vlan);
         });
 
         make_ok(response);
@@ -280,46 +645,55 @@ void ControlImpl::AttachRealService(RpcController *controller,
       });
 }
 
-void ControlImpl::DetachRealService(RpcController *controller,
-                                    const RealServiceRequest *request,
-                                    GeneralResponse *response, Closure *done) {
+template <typename Addr>
+void detach_real_service(const RealServiceRequest *request,
+                         GeneralResponse *response, Closure *done) {
   brpc::ClosureGuard done_guard(done);
 
-  auto vpair = validate_service(request->virt(), response->mutable_error());
+  if (is_ipv6(request->real()) != is_ipv6(request->virt())) {
+    make_error(response, "real service must be in the same address family");
+    return;
+  }
+
+  auto vpair =
+      validate_service<Addr>(request->virt(), response->mutable_error());
   if (!vpair.first) return;
-  auto rpair = validate_service(request->real(), response->mutable_error());
+  auto rpair =
+      validate_service<Addr>(request->real(), response->mutable_error());
   if (!rpair.first) return;
 
   done_guard.release();
 
   Exec::InTrivial(
-      [vtuple = vpair.second, rtuple = rpair.second, response, done]() {
+      [vtuple = vpair.second, rtuple = rpair.second,
+       protocol = protocol_of(request->virt()), response, done]() {
         brpc::ClosureGuard done_guard(done);
 
-        auto vs = STABLE.FindVs(vtuple);
+        auto vs = STABLE_OF(Addr).FindVs(vtuple, protocol);
         if (!vs) {
           make_warn(response, "virtual service does not exist");
           return;
         }
 
-        auto rs = STABLE.FindRs(rtuple);
+        auto rs = STABLE_OF(Addr).FindRs(rtuple);
         if (rs) {
-          auto pair = STABLE.RsAttached(vs, rs);
+          auto pair = STABLE_OF(Addr).RsAttached(vs, rs);
           if (!pair.first) {
             make_warn(response, "real service has detached");
             return;
           }
 
-          STABLE.DetachRs(vs, rs, pair.second);
+          STABLE_OF(Addr).DetachRs(vs, rs, pair.second);
 
           // For the case of adding the same rs immediately after deletion
           // if (STABLE.RsDetached(rs)) rs->metrics()->Hide();
 
-          Exec::InSlaves([vtuple, rtuple]() {
-            auto vs = STABLE.FindVs(vtuple);
-            auto rs = STABLE.FindRs(rtuple);
+          Exec::InSlaves([vtuple, rtuple, protocol]() {
+            auto vs = STABLE_OF(Addr).FindVs(vtuple, protocol);
+            auto rs = STABLE_OF(Addr).FindRs(rtuple);
 
-            STABLE.DetachRs(vs, rs, STABLE.RsAttached(vs, rs).second);
+            STABLE_OF(Addr).DetachRs(vs, rs,
+                                     STABLE_OF(Addr).RsAttached(vs, rs).second);
           });
         } else {
           make_warn(response, "real service does not exist");
@@ -332,29 +706,30 @@ void ControlImpl::DetachRealService(RpcController *controller,
       });
 }
 
-void ControlImpl::ListRealService(RpcController *controller,
-                                  const VirtualServiceRequest *request,
-                                  ServicesResponse *response, Closure *done) {
+template <typename Addr>
+void list_real_service(const VirtualServiceRequest *request,
+                       ServicesResponse *response, Closure *done) {
   brpc::ClosureGuard done_guard(done);
 
-  auto pair = validate_service(request->svc(), response->mutable_error());
+  auto pair = validate_service<Addr>(request->svc(), response->mutable_error());
   if (!pair.first) return;
 
   done_guard.release();
 
-  Exec::InTrivial([tuple = pair.second, response, done]() {
+  Exec::InTrivial([tuple = pair.second,
+                   protocol = protocol_of(request->svc()), response, done]() {
     brpc::ClosureGuard done_guard(done);
 
-    auto vs = STABLE.FindVs(tuple);
+    auto vs = STABLE_OF(Addr).FindVs(tuple, protocol);
 
     if (!vs) {
       make_error(response, "virtual service does not exist");
       return;
     }
 
-    STABLE.ForeachRs(vs, [response](auto *rs) {
+    STABLE_OF(Addr).ForeachRs(vs, [response](auto *rs) {
       auto resp_rs = response->add_list();
-      resp_rs->set_addr(ToIpv4Address(rs->tuple().ip));
+      resp_rs->set_addr(ToIpAddress(rs->tuple().ip));
       resp_rs->set_port(rs->tuple().port.value());
     });
 
@@ -369,4 +744,250 @@ void ControlImpl::ListRealService(RpcController *controller,
   });
 }
 
+}  // namespace
+
+void ControlImpl::AddVirtualService(RpcController *controller,
+                                    const VirtualServiceRequest *request,
+                                    GeneralResponse *response, Closure *done) {
+  if (is_ipv6(request->svc()))
+    add_virtual_service<Ipv6::Address>(request, response, done);
+  else
+    add_virtual_service<be32_t>(request, response, done);
+}
+
+void ControlImpl::DelVirtualService(RpcController *controller,
+                                    const VirtualServiceRequest *request,
+                                    GeneralResponse *response, Closure *done) {
+  if (is_ipv6(request->svc()))
+    del_virtual_service<Ipv6::Address>(request, response, done);
+  else
+    del_virtual_service<be32_t>(request, response, done);
+}
+
+void ControlImpl::ListVirtualService(RpcController *controller,
+                                     const EmptyRequest *request,
+                                     ServicesResponse *response,
+                                     Closure *done) {
+  brpc::ClosureGuard done_guard(done);
+
+  done_guard.release();
+
+  Exec::InTrivial([response, done]() {
+    brpc::ClosureGuard done_guard(done);
+
+    auto add_vs = [response](auto *vs) {
+      auto *resp_vs = response->add_list();
+      resp_vs->set_addr(ToIpAddress(vs->tuple().ip));
+      resp_vs->set_port(vs->tuple().port.value());
+      resp_vs->set_protocol(
+          vs->protocol() == conntrack::Protocol::kUdp ? UDP : TCP);
+    };
+
+    STABLE.ForeachVs(add_vs);
+    STABLE6.ForeachVs(add_vs);
+
+    if (response->list().empty()) {
+      make_warn(response, "there is no virtual service");
+      return;
+    }
+
+    make_ok(response);
+    done_guard.release();
+    trivial_done(done);
+  });
+}
+
+void ControlImpl::AttachRealService(RpcController *controller,
+                                    const RealServiceRequest *request,
+                                    GeneralResponse *response, Closure *done) {
+  if (is_ipv6(request->virt()))
+    attach_real_service<Ipv6::Address>(request, response, done);
+  else
+    attach_real_service<be32_t>(request, response, done);
+}
+
+void ControlImpl::DetachRealService(RpcController *controller,
+                                    const RealServiceRequest *request,
+                                    GeneralResponse *response, Closure *done) {
+  if (is_ipv6(request->virt()))
+    detach_real_service<Ipv6::Address>(request, response, done);
+  else
+    detach_real_service<be32_t>(request, response, done);
+}
+
+void ControlImpl::ListRealService(RpcController *controller,
+                                  const VirtualServiceRequest *request,
+                                  ServicesResponse *response, Closure *done) {
+  if (is_ipv6(request->svc()))
+    list_real_service<Ipv6::Address>(request, response, done);
+  else
+    list_real_service<be32_t>(request, response, done);
+}
+
+// Routes are shared by slaves, so they are only modified in the trivial
+void ControlImpl::AddRoute(RpcController *controller, const Route *request,
+                           GeneralResponse *response, Closure *done) {
+  brpc::ClosureGuard done_guard(done);
+
+  be32_t prefix;
+  uint8_t depth;
+  std::vector<be32_t> gateways;
+  uint16_t port;
+  uint32_t vlan;
+
+  if (!validate_route(*request, true, &prefix, &depth, &gateways, &port,
+                      &vlan, response->mutable_error()))
+    return;
+
+  done_guard.release();
+
+  Exec::InTrivial([prefix, depth, gateways, port, vlan, response, done]() {
+    // Tbl8s freed by the routes removed may still be read by slaves
+    ROUTES.AfterGrace([prefix, depth, gateways, port, vlan, response, done]() {
+      brpc::ClosureGuard done_guard(done);
+
+      if (!ROUTES.Add(prefix, depth, gateways, port, vlan)) {
+        make_error(response, "number of routes exceeds the limit");
+        return;
+      }
+
+      make_ok(response);
+    });
+  });
+}
+
+void ControlImpl::DelRoute(RpcController *controller, const Route *request,
+                           GeneralResponse *response, Closure *done) {
+  brpc::ClosureGuard done_guard(done);
+
+  be32_t prefix;
+  uint8_t depth;
+
+  if (!validate_route(*request, false, &prefix, &depth, nullptr, nullptr,
+                      nullptr, response->mutable_error()))
+    return;
+
+  done_guard.release();
+
+  Exec::InTrivial([prefix, depth, response, done]() {
+    brpc::ClosureGuard done_guard(done);
+
+    if (!ROUTES.Remove(prefix, depth)) {
+      make_warn(response, "route does not exist");
+      return;
+    }
+
+    make_ok(response);
+  });
+}
+
+void ControlImpl::ListRoute(RpcController *controller,
+                            const EmptyRequest *request,
+                            RoutesResponse *response, Closure *done) {
+  brpc::ClosureGuard done_guard(done);
+
+  done_guard.release();
+
+  Exec::InTrivial([response, done]() {
+    brpc::ClosureGuard done_guard(done);
+
+    ROUTES.Foreach([response](const be32_t &prefix, uint8_t depth,
+                              const std::vector<be32_t> &gateways,
+                              uint16_t port, uint32_t vlan) {
+      auto *route = response->add_list();
+      route->set_prefix(ToIpv4Address(prefix) + "/" + std::to_string(depth));
+      for (auto &gateway : gateways)
+        route->add_gateways(ToIpv4Address(gateway));
+      if (port) route->set_port(port);
+      if (vlan) route->set_vlan(ToVlan(vlan));
+    });
+
+    if (response->list().empty()) {
+      make_warn(response, "there is no route");
+      return;
+    }
+
+    make_ok(response);
+  });
+}
+
+void ControlImpl::ParkSlaves(RpcController *controller,
+                             const SlavesRequest *request,
+                             GeneralResponse *response, Closure *done) {
+  brpc::ClosureGuard done_guard(done);
+
+  std::vector<uint16_t> ids;
+
+  if (!validate_slaves(*request, true, &ids, response->mutable_error()))
+    return;
+
+  done_guard.release();
+
+  // Connections of the draining slaves are left to them, new flows are spread
+  // over the others once rss is changed
+  Exec::InTrivial([ids, response, done]() {
+    brpc::ClosureGuard done_guard(done);
+
+    std::vector<uint16_t> parked;
+    for (auto id : ids)
+      if (Worker::Park(id)) parked.emplace_back(id);
+
+    if (!update_reta()) {
+      for (auto id : parked) Worker::Activate(id);
+      update_reta();
+
+      make_error(response, "failed to update rss of ports");
+      return;
+    }
+
+    if (parked.size() < ids.size()) {
+      make_warn(response, "some of the slaves are not active");
+      return;
+    }
+
+    make_ok(response);
+  });
+}
+
+void ControlImpl::ActivateSlaves(RpcController *controller,
+                                 const SlavesRequest *request,
+                                 GeneralResponse *response, Closure *done) {
+  brpc::ClosureGuard done_guard(done);
+
+  std::vector<uint16_t> ids;
+
+  if (!validate_slaves(*request, false, &ids, response->mutable_error()))
+    return;
+
+  done_guard.release();
+
+  Exec::InTrivial([ids, response, done]() {
+    brpc::ClosureGuard done_guard(done);
+
+    for (auto id : ids) Worker::Activate(id);
+
+    if (!update_reta()) {
+      make_error(response, "failed to update rss of ports");
+      return;
+    }
+
+    make_ok(response);
+  });
+}
+
+void ControlImpl::ListSlaves(RpcController *controller,
+                             const EmptyRequest *request,
+                             SlavesResponse *response, Closure *done) {
+  brpc::ClosureGuard done_guard(done);
+
+  for (uint16_t id = 0; id < CONFIG.slave_cores.size(); ++id) {
+    auto *slave = response->add_list();
+    slave->set_id(id);
+    slave->set_core(CONFIG.slave_cores[id]);
+    slave->set_state(static_cast<SlaveState>(Worker::state(id)));
+  }
+
+  make_ok(response);
+}
+
 }  // namespace xlb::rpc
@@ -35,6 +35,23 @@ class ControlImpl final : public Control {
                        const VirtualServiceRequest *request,
                        ServicesResponse *response, Closure *done) override;
 
+  void AddRoute(RpcController *controller, const Route *request,
+                GeneralResponse *response, Closure *done) override;
+
+  void DelRoute(RpcController *controller, const Route *request,
+                GeneralResponse *response, Closure *done) override;
+
+  void ListRoute(RpcController *controller, const EmptyRequest *request,
+                 RoutesResponse *response, Closure *done) override;
+
+  void ParkSlaves(RpcController *controller, const SlavesRequest *request,
+                  GeneralResponse *response, Closure *done) override;
+
+  void ActivateSlaves(RpcController *controller, const SlavesRequest *request,
+                      GeneralResponse *response, Closure *done) override;
+
+  void ListSlaves(RpcController *controller, const EmptyRequest *request,
+                  SlavesResponse *response, Closure *done) override;
 };
 
 }  // namespace xlb::rpc
@@ -14,6 +14,7 @@
 #include <functional>
 #include <iomanip>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <type_traits>
@@ -40,6 +41,7 @@
 
 #include "headers/ether.h"
 #include "headers/ip.h"
+#include "headers/ipv6.h"
 
 #include "utils/allocator.h"
 #include "utils/boost.h"
@@ -29,11 +29,46 @@ void Config::validate() {
 
   // TODO: more detail log
   CHECK(!slave_cores.empty());
-  CHECK_LE(slave_cores.size(), 32);
+  // Ids of master and trivial follow those of slaves
+  CHECK_LE(slave_cores.size(), UINT16_MAX - 2);
+
+  // Ports are packed in 4 bits along with the vlan of neighbors
+  CHECK(!nic.ports.empty());
+  CHECK_LE(nic.ports.size(), 16);
+
+  std::vector<std::string> devices;
+
+  for (auto &port : nic.ports) {
+    std::vector<std::string> members{port.pci_address};
+
+    if (port.bond_members.empty()) {
+      CHECK_NE(port.pci_address, "");
+    } else {
+      CHECK_EQ(port.pci_address, "");
+      CHECK_GE(port.bond_members.size(), 2);
+      CHECK(port.bond_mode == "lacp" || port.bond_mode == "active_backup");
+      members = port.bond_members;
+    }
+
+    for (auto &member : members) {
+      auto socket = utils::PciSocketId(member);
+      CHECK(socket.has_value());
+      if (&member != &members.front()) CHECK_EQ(port.socket, socket.value());
+      port.socket = socket.value();
+    }
+
+    devices.insert(devices.end(), members.begin(), members.end());
+    sockets.emplace_back(port.socket);
+  }
+
+  // Each device is bound once
+  CHECK_EQ(utils::unique(utils::sort(devices)).size(), devices.size());
+
+  nic.socket = nic.ports.front().socket;
 
-  auto socket = utils::PciSocketId(nic.pci_address);
-  CHECK(socket.has_value());
-  nic.socket = socket.value();
+  sockets.emplace_back(utils::CoreSocketId(master_core).value());
+  CHECK(utils::CoreSocketId(trivial_core));
+  sockets.emplace_back(utils::CoreSocketId(trivial_core).value());
 
   for (auto &w : slave_cores) {
     CHECK_NE(w, master_core);
@@ -41,9 +76,32 @@ void Config::validate() {
 
     auto socket_id = utils::CoreSocketId(w);
     CHECK(socket_id.has_value());
-    CHECK_EQ(nic.socket, socket_id.value());
+    sockets.emplace_back(socket_id.value());
+
+    // Otherwise it would poll nothing
+    if (std::none_of(nic.ports.begin(), nic.ports.end(), [&](auto &port) {
+          return port.socket == int(socket_id.value());
+        }))
+      F_LOG(FATAL) << "no port on the socket of slave core: " << w;
+  }
+
+  // Flows to the local ips of a slave are steered to its own queue on the
+  // port, which is the one at its position in 'slaves'
+  for (auto &port : nic.ports) {
+    for (uint16_t id = 0; id < slave_cores.size(); ++id)
+      if (utils::CoreSocketId(slave_cores[id]).value() == port.socket)
+        port.slaves.emplace_back(id);
+
+    if (port.slaves.empty())
+      F_LOG(FATAL) << "no slave on the socket of port: " << port.socket;
+
+    if (port.rx_queues == 0) port.rx_queues = port.slaves.size();
+    CHECK_GE(port.rx_queues, port.slaves.size());
   }
 
+  sockets.erase(utils::unique(utils::sort(sockets)).end(), sockets.end());
+  CHECK_LT(sockets.back(), RTE_MAX_NUMA_NODES);
+
   CHECK_GT(execute_channel_size, 0);
 
   // TODO: validate legality
@@ -51,12 +109,20 @@ void Config::validate() {
   CHECK_GT(rpc.max_concurrency, 0);
 
   CHECK_NE(nic.name, "");
-  CHECK_NE(nic.pci_address, "");
   //  CHECK_NE(nic.netmask, "");
 
   CHECK_GT(nic.mtu, 0);
   CHECK_LE(nic.mtu, UINT16_MAX);
 
+  // Reset by each port that is not capable
+  nic.rx_cksum_offload = true;
+  nic.rx_vlan_strip = true;
+  nic.rx_qinq_strip = true;
+  nic.tx_vlan_insert = true;
+  nic.tx_qinq_insert = true;
+  nic.rx_ptype = true;
+  nic.tx_udp_cksum_offload = nic.tx_cksum_offload;
+
   CHECK_NE(kni.ip_address, "");
   CHECK_NE(kni.netmask, "");
   CHECK_NE(kni.gateway, "");
@@ -70,25 +136,52 @@ void Config::validate() {
   CHECK_GT(mem.packet_pool, 512 * slave_cores.size());
   //  CHECK_EQ(mem.packet_pool % 2, 0);
 
-  CHECK(!nic.local_ips.empty());
   //  std::sort(nic.local_ips.begin(), nic.local_ips.end());
   //  utils::sort(nic.local_ips);
 
   //  CHECK(!nic.local_ips.empty());
-  CHECK_EQ(nic.local_ips.size() % slave_cores.size(), 0);
   //  CHECK(std::unique(nic.local_ips.begin(), nic.local_ips.end()) ==
   //        nic.local_ips.end());
 
-  CHECK_EQ(utils::unique(utils::sort(nic.local_ips)).size(),
-           nic.local_ips.size());
-
   //  utils::unique(nic.local_ips);
 
   utils::be32_t _dummy;
+  headers::Ipv6::Address _dummy6;
+
+  for (uint16_t i = 0; i < nic.ports.size(); ++i) {
+    auto &slaves = nic.ports[i].slaves;
+    size_t ips = 0, ips6 = 0;
+
+    for (auto &ip : nic.ports[i].local_ips) {
+      // Suffixed with the vlan if tagged, such as "10.0.0.1%100"
+      uint32_t vlan = 0;
+      auto pos = ip.find('%');
+      if (pos != std::string::npos) {
+        CHECK(headers::ParseVlan(ip.substr(pos + 1), &vlan));
+        ip.resize(pos);
+      }
+
+      // The same ip must not be on two ports either
+      if (headers::ParseIpv4Address(ip, &_dummy)) {
+        slave_local_ips.emplace(slaves[ips++ % slaves.size()], _dummy);
+        CHECK(local_ip_links.emplace(_dummy, Link{i, vlan}).second);
+      } else {
+        CHECK(headers::ParseIpv6Address(ip, &_dummy6));
+        slave_local_ips6.emplace(slaves[ips6++ % slaves.size()], _dummy6);
+        CHECK(local_ip6_links.emplace(_dummy6, Link{i, vlan}).second);
+      }
+    }
+
+    // Local ips of each family are evenly distributed to the slaves of the
+    // port
+    CHECK_EQ(ips % slaves.size(), 0);
+    CHECK_EQ(ips6 % slaves.size(), 0);
+  }
 
-  for (auto i : utils::irange(nic.local_ips.size())) {
-    CHECK(headers::ParseIpv4Address(nic.local_ips[i], &_dummy));
-    slave_local_ips.emplace(i % slave_cores.size(), _dummy);
+  // Every slave takes full-nat connections, ipv6 ones if any
+  for (uint16_t id = 0; id < slave_cores.size(); ++id) {
+    CHECK_GT(slave_local_ips.count(id), 0);
+    if (!slave_local_ips6.empty()) CHECK_GT(slave_local_ips6.count(id), 0);
   }
 
   //  for (auto &ip : nic.local_ips) CHECK(headers::ParseIpv4Address(ip,
@@ -102,6 +195,49 @@ void Config::validate() {
   CHECK_GT(svc.max_real_service, 0);
   CHECK_GT(svc.max_real_per_virtual, 0);
   CHECK_GT(svc.max_conn, 0);
+  if (svc.max_ipv6_conn > 0) CHECK(!slave_local_ips6.empty());
+  CHECK_GT(svc.max_persistence, 0);
+
+  CHECK_GT(outlier.interval, 0);
+  CHECK_GT(outlier.failure_ratio, 0);
+  CHECK_LE(outlier.failure_ratio, 1);
+  CHECK_GT(outlier.base_ejection_time, 0);
+  CHECK_GE(outlier.max_ejection_time, outlier.base_ejection_time);
+
+  if (frag.max_datagrams > 0) {
+    CHECK_GT(frag.timeout, 0);
+    // Held fragments must not exhaust the packet pool
+    CHECK_LE(frag.max_held * slave_cores.size(), mem.packet_pool / 4);
+
+    F_LOG(WARNING) << "fragments are tracked, connections are spread over "
+                      "slaves by hosts only";
+  }
+
+  if (udp.max_flows > 0) CHECK_GT(udp.timeout, 0);
+
+  CHECK_GT(tunnel.gue_port, 0);
+
+  // Next hops of lpm are of 24 bits
+  CHECK_GE(route.max_routes, 2);
+  CHECK_LT(route.max_routes, 1 << 24);
+  CHECK_GT(route.max_neighbors, 0);
+  CHECK_GT(route.neighbor_timeout, 0);
+  CHECK_GT(route.probe_interval, 0);
+
+  if (!route.ipv6_gateway.empty()) {
+    auto &gateway = route.ipv6_gateway;
+    auto pos = gateway.find('%');
+
+    route.ipv6_gateway_vlan = 0;
+    if (pos != std::string::npos)
+      CHECK(headers::ParseVlan(gateway.substr(pos + 1),
+                               &route.ipv6_gateway_vlan));
+
+    CHECK(route.ipv6_gateway_addr.FromString(gateway.substr(0, pos)));
+    CHECK_LT(route.ipv6_gateway_port, nic.ports.size());
+  } else if (svc.max_ipv6_conn > 0) {
+    F_LOG(WARNING) << "no ipv6 gateway, ipv6 services are rejected";
+  }
 }
 
 }  // namespace xlb
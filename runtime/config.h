@@ -7,20 +7,64 @@ namespace xlb {
 struct Config {
  public:
   struct Nic {
+    // Each one is bound by pmd with its own queue per slave, such as one
+    // facing clients and another one facing real services. The first one is
+    // also bound to kni.
+    struct Port {
+      std::string pci_address;
+      // Pci addresses of the members if it is a bonded device rather than
+      // 'pci_address', such as one to each of the dual-homed switches
+      std::vector<std::string> bond_members;
+      // Of a bonded device, either "lacp" or "active_backup". Lacpdu take
+      // queues of their own if the members support flow isolation, otherwise
+      // they go through the bursts of slaves, which must send at least every
+      // 100ms for lacp to keep the members aggregated.
+      std::string bond_mode;
+      // Number of rx queues, polled in turn by the slaves on the socket of the
+      // port. There is at least one for each of them, which is the default if
+      // it is 0.
+      uint16_t rx_queues;
+      // Set when verifying configuration, members of a bonded device must be
+      // on the same one
+      int socket;
+      // Set when verifying configuration, ids of the slaves on the socket in
+      // order, rx queue q is polled by the one at q % size
+      std::vector<uint16_t> slaves;
+      // Either ipv4 or ipv6, for the snat of each family. Suffixed with the
+      // vlan if tagged, such as "10.0.0.1%100" or "10.0.0.1%200.100" for QinQ.
+      std::vector<std::string> local_ips;
+      // Set when pmd is initialized
+      headers::Ethernet::Address mac_address;
+    };
+
     std::string name;
-    std::string pci_address;
-    // Set when pmd is initialized
-    headers::Ethernet::Address mac_address;
-    std::vector<std::string> local_ips;
+    std::vector<Port> ports;
     uint16_t mtu;
-    // Set when verifying configuration
+    // Set when verifying configuration, the socket of the first port, where
+    // structures shared by slaves are
     int socket;
-    // TODO: offload & vlan
+    // Otherwise the checksums of rewritten packets are patched incrementally,
+    // reset when pmd is initialized if any port is not capable
+    bool tx_cksum_offload;
+    // Of udp, which follows 'tx_cksum_offload' but is reset on its own
+    bool tx_udp_cksum_offload;
+    // Reset when pmd is initialized if any port is not capable, then it is
+    // done in software
+    bool rx_cksum_offload;
+    bool rx_vlan_strip;
+    bool rx_qinq_strip;
+    bool tx_vlan_insert;
+    bool tx_qinq_insert;
+    // Reset when pmd is initialized, unless every port classifies ipv4 and
+    // tcp packets
+    bool rx_ptype;
   };
 
   struct Mem {
+    // In megabytes, split evenly among the sockets in use
     size_t hugepage;
     size_t channel;
+    // Packets in the pool of each socket in use
     size_t packet_pool;
   };
 
@@ -36,6 +80,10 @@ struct Config {
     size_t max_real_service;
     size_t max_real_per_virtual;
     size_t max_conn;
+    // Connections of ipv6 in each slave, 0 to disable ipv6
+    size_t max_ipv6_conn;
+    // Sessions of source ip persistence in each slave
+    size_t max_persistence;
   };
 
   struct Rpc {
@@ -43,18 +91,107 @@ struct Config {
     size_t max_concurrency;
   };
 
+  // Passive outlier detection based on the handshakes seen by slaves
+  struct Outlier {
+    // In milliseconds
+    uint64_t interval;
+    // Real services with fewer handshakes in an interval are not judged
+    uint64_t min_handshakes;
+    double failure_ratio;
+    // In milliseconds, doubled by each consecutive ejection
+    uint64_t base_ejection_time;
+    uint64_t max_ejection_time;
+  };
+
+  // Fragments of a datagram follow the connection of its first fragment
+  struct Frag {
+    // Datagrams tracked in each slave, 0 to drop all fragments. Otherwise rss
+    // hashes only the addresses of all packets so that fragments reach the
+    // slave of their connection, and all connections between two hosts, such
+    // as from a nat gateway to a vip, are handled by one slave. Off by default.
+    size_t max_datagrams;
+    // Fragments held in each slave until the first fragment of their
+    // datagrams arrive
+    size_t max_held;
+    // In milliseconds
+    uint64_t timeout;
+  };
+
+  // Udp flows are tracked until they are idle for the timeout
+  struct Udp {
+    // Flows in each slave, 0 to drop all udp
+    size_t max_flows;
+    // In milliseconds
+    uint64_t timeout;
+  };
+
+  // Icmp errors about connections are translated and forwarded to the peers,
+  // echo requests to vips are answered
+  struct Icmp {
+    // Messages handled per second in each slave, 0 to drop all icmp
+    uint64_t rate;
+  };
+
+  // Of virtual services in tunnel modes
+  struct Tunnel {
+    // Udp port of rs to decapsulate gue
+    uint16_t gue_port;
+  };
+
+  // Routes of ipv4 and neighbors resolving their next hops
+  struct Route {
+    // Including the segment of kni and the default route through its gateway
+    size_t max_routes;
+    // Neighbors cached in each slave, those not used for the timeout or not
+    // resolved after a few probes are evicted
+    size_t max_neighbors;
+    // In seconds, since the last arp of a neighbor
+    uint64_t neighbor_timeout;
+    // In milliseconds, between arp requests for a neighbor in each slave
+    uint64_t probe_interval;
+    // Mac address of the next hop of all ipv6 traffic, suffixed with the vlan
+    // if tagged, such as "00:11:22:33:44:55%100". Routes and neighbors of
+    // ipv6 are not resolved, so ipv6 services are rejected unless it is set.
+    std::string ipv6_gateway;
+    // Index of the port where the gateway is
+    uint16_t ipv6_gateway_port;
+    // Set when verifying configuration
+    headers::Ethernet::Address ipv6_gateway_addr;
+    uint32_t ipv6_gateway_vlan;
+  };
+
+  // A port and a vlan on it, the vlan is 0 if untagged
+  struct Link {
+    uint16_t port;
+    uint32_t vlan;
+  };
+
+  // Slaves may be on any socket, and each of them allocates from its own one.
+  // They only poll the ports on their socket, so there must be one on each
+  // socket of slaves, and flows stay on the socket they came in.
   std::vector<uint16_t> slave_cores;
   uint8_t master_core;
   uint8_t trivial_core;
   size_t execute_channel_size;
+  // Set when verifying configuration, of ports and workers
+  std::vector<int> sockets;
   std::unordered_multimap<uint16_t, utils::be32_t> slave_local_ips;
+  std::unordered_multimap<uint16_t, headers::Ipv6::Address> slave_local_ips6;
+  // Where each local ip is
+  std::unordered_map<utils::be32_t, Link> local_ip_links;
+  std::unordered_map<headers::Ipv6::Address, Link> local_ip6_links;
 
-  // TODO: support multi numa node
   Nic nic;
   Mem mem;
   Kni kni;
   Svc svc;
   Rpc rpc;
+  Outlier outlier;
+  Frag frag;
+  Udp udp;
+  Icmp icmp;
+  Tunnel tunnel;
+  Route route;
 
   static void Load();
 
@@ -66,11 +203,24 @@ struct Config {
 
 }  // namespace xlb
 
-VISITABLE_STRUCT(xlb::Config::Nic, name, pci_address, local_ips, mtu);
+VISITABLE_STRUCT(xlb::Config::Nic::Port, pci_address, bond_members, bond_mode,
+                 rx_queues, local_ips);
+VISITABLE_STRUCT(xlb::Config::Nic, name, ports, mtu, tx_cksum_offload);
 VISITABLE_STRUCT(xlb::Config::Mem, hugepage, channel, packet_pool);
 VISITABLE_STRUCT(xlb::Config::Kni, ip_address, netmask, gateway, ring_size);
 VISITABLE_STRUCT(xlb::Config::Svc, max_virtual_service, max_real_service,
-                 max_real_per_virtual, max_conn);
+                 max_real_per_virtual, max_conn, max_ipv6_conn,
+                 max_persistence);
 VISITABLE_STRUCT(xlb::Config::Rpc, ip_port, max_concurrency);
+VISITABLE_STRUCT(xlb::Config::Outlier, interval, min_handshakes, failure_ratio,
+                 base_ejection_time, max_ejection_time);
+VISITABLE_STRUCT(xlb::Config::Frag, max_datagrams, max_held, timeout);
+VISITABLE_STRUCT(xlb::Config::Udp, max_flows, timeout);
+VISITABLE_STRUCT(xlb::Config::Icmp, rate);
+VISITABLE_STRUCT(xlb::Config::Tunnel, gue_port);
+VISITABLE_STRUCT(xlb::Config::Route, max_routes, max_neighbors,
+                 neighbor_timeout, probe_interval, ipv6_gateway,
+                 ipv6_gateway_port);
 VISITABLE_STRUCT(xlb::Config, slave_cores, master_core, trivial_core,
-                 execute_channel_size, nic, mem, kni, svc, rpc);
+                 execute_channel_size, nic, mem, kni, svc, rpc, outlier, frag,
+                 udp, icmp, tunnel, route);
@@ -49,6 +49,19 @@ class CmdLineOpts {
   std::vector<char *> argv_;
 };
 
+// Hugepages are split evenly among the sockets in use, such as "0,512,0,512"
+std::string socket_mem() {
+  std::string ret;
+  size_t mem = CONFIG.mem.hugepage / CONFIG.sockets.size();
+
+  for (int i = 0; i <= CONFIG.sockets.back(); ++i) {
+    if (i > 0) ret += ",";
+    ret += utils::any_of_equal(CONFIG.sockets, i) ? std::to_string(mem) : "0";
+  }
+
+  return ret;
+}
+
 void init_eal() {
   // TODO: clean useless args
   CmdLineOpts rte_args{
@@ -61,8 +74,8 @@ void init_eal() {
       // since we don't want to interfere with other DPDK applications.
       "--no-shconf",
       "--huge-unlink",
-      "-m",
-      std::to_string(CONFIG.mem.hugepage),
+      "--socket-mem",
+      socket_mem(),
       "-n",
       std::to_string(CONFIG.mem.channel),
   };
@@ -114,6 +127,7 @@ void InitDpdk() {
 
     F_DLOG(INFO) << "tsc_hz: " << utils::tsc_hz;
 
+    // Workers allocate from their own sockets, see Worker::run()
     utils::InitDefaultAllocator(CONFIG.nic.socket);
   }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "runtime/common.h"
+#include "runtime/config.h"
 #include "runtime/worker.h"
 
 namespace xlb {
@@ -61,6 +62,12 @@ class Exec {
 
     return cnt;
   }
+
+  // For a registered thread with nothing else to do, see 'Channel::Wait'
+  template <typename Rep, typename Period>
+  static void Wait(const std::chrono::duration<Rep, Period> &timeout) {
+    Channel::Wait(timeout);
+  }
 };
 
 }  // namespace xlb
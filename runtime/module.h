@@ -67,14 +67,20 @@ class Module {
 
   Module() { Modules::instance().emplace_back(this); }
 
-  // T must be a type_string, such as 'TS("your_task")'
+  // T must be a type_string, such as 'TS("your_task")'. Tasks of the same
+  // name in a worker are told apart by 'instance', which is appended to it.
+  // 'polling' tasks receive from queues of nic.
   template <typename T>
-  void RegisterTask(Func &&func) {
+  void RegisterTask(Func &&func, std::string_view instance = {},
+                    bool polling = false) {
     auto worker = Worker::current();
     DCHECK_NOTNULL(worker);
 
-    W_LOG(INFO) << "module: " << module_name() << " name: " << T::data();
-    worker->scheduler()->RegisterTask(std::move(func), T::data());
+    std::string name(T::data());
+    if (!instance.empty()) name.append("_").append(instance);
+
+    W_LOG(INFO) << "module: " << module_name() << " name: " << name;
+    worker->scheduler()->RegisterTask(std::move(func), name, polling);
   }
 
   // Avoid virtual function calls, reduce branch prediction failure, and let the
@@ -115,8 +121,13 @@ inline void *Worker::run() {
   pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_), &cpu_set_);
   pthread_setname_np(pthread_self(), name.c_str());
 
-  // DPDK lcore ID == worker ID (0, 1, 2, 3, ...)
-  RTE_PER_LCORE(_lcore_id) = id_;
+  // Tables of modules initialized in this worker are local to it
+  utils::BindAllocator(socket_);
+
+  // DPDK lcore ID == worker ID (0, 1, 2, 3, ...) below that of the master lcore
+  // of EAL. Workers beyond it have no cache of mempools.
+  RTE_PER_LCORE(_lcore_id) =
+      id_ < rte_get_master_lcore() ? id_ : LCORE_ID_ANY;
 
   // shouldn't be SOCKET_ID_ANY (-1)
   CHECK_GE(socket_, 0);
@@ -173,6 +184,14 @@ inline void Scheduler::Loop() {
     update_cpu_usage<T>(idle, cycles);
     checkpoint_ = W_TSC;
 
+    // A parked slave leaves the core to others and polls no queue, its other
+    // tasks are run only when woken up
+    if constexpr (T == Worker::Slave)
+      if (unlikely(Worker::state(W_ID) == Worker::Parked)) {
+        park();
+        continue;
+      }
+
     execute();
   }
 }
@@ -103,6 +103,9 @@ class alignas(64) Packet {
   size_t l3_len() { return mbuf_.l3_len; }
   size_t l4_len() { return mbuf_.l4_len; }
 
+  uint32_t packet_type() const { return packet_type_; }
+  void set_packet_type(uint32_t ptype) { packet_type_ = ptype; }
+
   uint64_t ol_flags() { return ol_flags_; }
   void set_ol_flags(uint64_t bit) { ol_flags_ |= bit; }
 
@@ -114,6 +117,36 @@ class alignas(64) Packet {
     return (ol_flags_ & PKT_RX_L4_CKSUM_MASK) == PKT_RX_L4_CKSUM_GOOD;
   }
 
+  // For the checksums validated in software
+  void set_rx_ip_cksum(bool good) {
+    ol_flags_ &= ~PKT_RX_IP_CKSUM_MASK;
+    ol_flags_ |= good ? PKT_RX_IP_CKSUM_GOOD : PKT_RX_IP_CKSUM_BAD;
+  }
+
+  void set_rx_l4_cksum(bool good) {
+    ol_flags_ &= ~PKT_RX_L4_CKSUM_MASK;
+    ol_flags_ |= good ? PKT_RX_L4_CKSUM_GOOD : PKT_RX_L4_CKSUM_BAD;
+  }
+
+  // Computed by nic, which picks the rx queue from the redirection table by it
+  bool has_rss_hash() const { return ol_flags_ & PKT_RX_RSS_HASH; }
+  uint32_t rss_hash() const { return hash_; }
+
+  // Ids of the tags stripped on rx, or to be inserted on tx, in the form of
+  // 'ParseVlan' in headers/ether.h
+  uint32_t vlan() const {
+    return (uint32_t(vlan_tci_outer_ & 0x0fff) << 16) | (vlan_tci_ & 0x0fff);
+  }
+
+  void set_vlan(uint32_t vlan) {
+    vlan_tci_ = vlan & 0x0fff;
+    vlan_tci_outer_ = vlan >> 16;
+  }
+
+  // The port it was received from, or to be sent to
+  uint16_t port() const { return port_; }
+  void set_port(uint16_t port) { port_ = port; }
+
   uint16_t headroom() const { return rte_pktmbuf_headroom(&mbuf_); }
 
   uint16_t tailroom() const { return rte_pktmbuf_tailroom(&mbuf_); }
@@ -357,9 +390,14 @@ class alignas(64) Packet {
     check_offset(data_off);
     check_offset(refcnt);
     check_offset(nb_segs);
+    check_offset(port);
     check_offset(rx_descriptor_fields1);
+    check_offset(packet_type);
     check_offset(pkt_len);
     check_offset(data_len);
+    check_offset(vlan_tci);
+    check_offset(hash);
+    check_offset(vlan_tci_outer);
     check_offset(buf_len);
     check_offset(pool);
     check_offset(next);
@@ -387,7 +425,7 @@ class alignas(64) Packet {
           uint16_t nb_segs_;  // Number of segments
 
           // offset 22:
-          uint16_t _dummy0_;  // rte_mbuf.port
+          uint16_t port_;  // Index of the port in config rather than dpdk
           // offset 24:
           uint64_t ol_flags_;  // rte_mbuf.ol_flags
         };
@@ -398,7 +436,7 @@ class alignas(64) Packet {
 
         struct {
           // offset 32:
-          uint32_t _dummy2_;  // rte_mbuf.packet_type_;
+          uint32_t packet_type_;  // Classified by nic, see RTE_PTYPE_*
 
           // offset 36:
           uint32_t pkt_len_;  // Total pkt length: sum of all segments
@@ -407,10 +445,10 @@ class alignas(64) Packet {
           uint16_t data_len_;  // Amount of data in this segment
 
           // offset 42:
-          uint16_t _dummy3_;  // rte_mbuf.vlan_tci
+          uint16_t vlan_tci_;  // VLAN TCI (CPU order), valid if stripped
 
           // offset 44:
-          uint32_t _dummy4_lo;  // rte_mbuf.fdir.lo and rte_mbuf.rss
+          uint32_t hash_;  // rte_mbuf.hash.rss and rte_mbuf.hash.fdir.lo
         };
       };
 
@@ -418,7 +456,7 @@ class alignas(64) Packet {
       uint32_t _dummy4_hi;  // rte_mbuf.fdir.hi
 
       // offset 52:
-      uint16_t _dummy5_;  // rte_mbuf.vlan_tci_outer
+      uint16_t vlan_tci_outer_;  // Outer VLAN TCI (CPU order)
 
       // offset 54:
       const uint16_t buf_len_;
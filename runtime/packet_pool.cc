@@ -21,15 +21,31 @@ void init_packet(rte_mempool *mp, void *, void *mbuf, unsigned index) {
 
 }  // namespace
 
-PacketPool::PacketPool(size_t capacity, int socket_id) {
-  // TODO: support multi numa node
+PacketPool &PacketPool::Of(int socket_id) {
+  static std::mutex mutex;
+  static std::array<std::unique_ptr<PacketPool>, RTE_MAX_NUMA_NODES> pools;
 
+  CHECK_GE(socket_id, 0);
+  CHECK_LT(socket_id, RTE_MAX_NUMA_NODES);
+
+  // Workers of other sockets may ask for their pools at the same time
+  std::lock_guard<std::mutex> guard(mutex);
+
+  auto &pool = pools[socket_id];
+  if (!pool) pool = std::make_unique<PacketPool>(socket_id);
+
+  return *pool;
+}
+
+PacketPool::PacketPool(int socket_id, size_t capacity) {
   F_LOG(INFO) << "creating with capacity: " << capacity
               << " packets on node: " << (socket_id == -1 ? 0 : socket_id);
 
-  pool_ = rte_mempool_create_empty("PacketPool", capacity, sizeof(Packet),
-                                   capacity > 1024 ? kMaxCacheSize : 0,
-                                   sizeof(PoolPrivate), socket_id, 0);
+  // Names of mempools are unique
+  pool_ = rte_mempool_create_empty(
+      utils::Format("PacketPool%d", socket_id).c_str(), capacity,
+      sizeof(Packet), capacity > 1024 ? kMaxCacheSize : 0, sizeof(PoolPrivate),
+      socket_id, 0);
   CHECK_NOTNULL(pool_);
 
   CHECK_EQ(rte_mempool_set_ops_byname(pool_, "ring_mp_mc", NULL), 0);
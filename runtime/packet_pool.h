@@ -11,10 +11,13 @@ namespace xlb {
 // Alloc() and Free() are thread-safe.
 class PacketPool {
  public:
-  explicit PacketPool(size_t capacity = CONFIG.mem.packet_pool,
-                      int socket_id = CONFIG.nic.socket);
+  explicit PacketPool(int socket_id, size_t capacity = CONFIG.mem.packet_pool);
   ~PacketPool();
 
+  // The pool of each socket, created on the first call. Rx queues are filled
+  // from the pools of the slaves polling them.
+  static PacketPool &Of(int socket_id);
+
   // PacketPool is neither copyable nor movable.
   PacketPool(const PacketPool &) = delete;
   PacketPool &operator=(const PacketPool &) = delete;
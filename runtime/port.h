@@ -21,7 +21,7 @@ class Port {
   };
 
   static const uint32_t kDefaultMtu = 1500;
-  static const uint32_t kMaxQueues = 32;
+  static const uint32_t kMaxQueues = RTE_MAX_QUEUES_PER_PORT;
 
   virtual ~Port() = default;
 
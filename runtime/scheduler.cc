@@ -1,4 +1,5 @@
 #include "runtime/scheduler.h"
+#include "runtime/exec.h"
 #include "runtime/module.h"
 
 namespace xlb {
@@ -32,8 +33,9 @@ bvar::PassiveStatus<double> cpu_usage_trivial("xlb_scheduler",
 
 Scheduler::Scheduler() : runnable_(ALLOC), checkpoint_() {}
 
-void Scheduler::RegisterTask(Task::Func &&func, std::string_view name) {
-  auto *task = new Task(std::move(func), name);
+void Scheduler::RegisterTask(Task::Func &&func, std::string_view name,
+                             bool polling) {
+  auto *task = new Task(std::move(func), name, polling);
   CHECK_EQ(
       task->display_weight_.expose_as(
           "xlb_scheduler", utils::Format("task_%s_%d_%s_weight", W_TYPE_STR,
@@ -62,6 +64,21 @@ Scheduler::Task::Context *Scheduler::next_ctx() {
   return &best->context_;
 }
 
+void Scheduler::park() {
+  Exec::Wait(kParkedTimeout);
+  W_CURRENT->UpdateTsc();
+
+  for (auto &task : runnable_) {
+    if (task->polling_) continue;
+
+    task->context_.silent_drops_ = 0;
+    task->execute(&task->context_);
+  }
+
+  W_CURRENT->UpdateTsc();
+  checkpoint_ = W_TSC;
+}
+
 void Scheduler::Task::update_weight(bool idle, uint64_t cycles) {
   int64_t expect_weight;
 
@@ -81,9 +98,10 @@ void Scheduler::Task::update_weight(bool idle, uint64_t cycles) {
   display_weight_.set_value(effective_weight_);
 }
 
-Scheduler::Task::Task(Func &&func, std::string_view name)
+Scheduler::Task::Task(Func &&func, std::string_view name, bool polling)
     : func_(std::move(func)),
       name_(name),
+      polling_(polling),
       min_weight_(kMinWeight * utils::tsc_us),
       max_weight_(kMaxWeight * utils::tsc_us),
       current_weight_(min_weight_),
@@ -51,7 +51,7 @@ class Scheduler {
 
     using Func = std::function<Result(Context *)>;
 
-    explicit Task(Func &&func, std::string_view name);
+    Task(Func &&func, std::string_view name, bool polling);
     ~Task();
 
    private:
@@ -65,6 +65,8 @@ class Scheduler {
     Func func_;
     // Just for debugging
     std::string name_;
+    // Receives from a queue of nic, which is not polled by a parked slave
+    bool polling_;
 
     int64_t min_weight_;
     int64_t max_weight_;
@@ -78,10 +80,13 @@ class Scheduler {
     friend Scheduler;
   };
 
-  void RegisterTask(Task::Func &&func, std::string_view name);
+  void RegisterTask(Task::Func &&func, std::string_view name, bool polling);
 
  private:
   using M = utils::Metric<TS("xlb_scheduler"), TS("cpu")>;
+
+  // Also how often the timers of a parked slave advance
+  static constexpr auto kParkedTimeout = std::chrono::milliseconds(100);
   using TaskQueue = utils::vector<Task *>;
 
   template <Worker::Type type>
@@ -89,6 +94,10 @@ class Scheduler {
 
   Task::Context *next_ctx();
 
+  // Run the tasks but the polling ones once a parked slave is woken up by the
+  // exec channel or the timeout
+  void park();
+
   TaskQueue runnable_;
   uint64_t checkpoint_;
 
@@ -8,6 +8,8 @@ namespace xlb {
 
 __thread Worker Worker::current_ = {};
 
+std::vector<std::atomic<Worker::State>> Worker::states_ = {};
+
 std::vector<std::thread> Worker::slave_threads_ = {};
 std::thread Worker::master_thread_ = {};
 std::thread Worker::trivial_thread_ = {};
@@ -30,7 +32,7 @@ void Worker::MarkStarted<Worker::Master>() {
 
 template <>
 void Worker::MarkStarted<Worker::Slave>() {
-  static std::atomic<uint16_t> counter = 0;
+  static std::atomic<size_t> counter = 0;
   if (counter.fetch_add(1) + 1 == CONFIG.slave_cores.size()) {
     W_LOG(INFO) << "All slaves have been started";
     internal<Trivial>::starting_.store(true, std::memory_order_release);
@@ -47,7 +49,7 @@ void Worker::MarkAborted<Worker::Trivial>() {
 
 template <>
 void Worker::MarkAborted<Worker::Slave>() {
-  static std::atomic<uint16_t> counter = 0;
+  static std::atomic<size_t> counter = 0;
   if (counter.fetch_add(1) + 1 == CONFIG.slave_cores.size()) {
     W_LOG(INFO) << "All slaves have been aborted";
     internal<Master>::aborting_.store(true, std::memory_order_release);
@@ -57,45 +59,65 @@ void Worker::MarkAborted<Worker::Slave>() {
 template <>
 void Worker::MarkAborted<Worker::Master>() {}
 
-Worker::Worker(uint16_t core, Type type)
+bool Worker::Parkable(uint16_t id) {
+  return std::none_of(CONFIG.nic.ports.begin(), CONFIG.nic.ports.end(),
+                      [id](auto &port) { return port.slaves.front() == id; });
+}
+
+bool Worker::Park(uint16_t id) {
+  State active = Active;
+
+  if (!Parkable(id) || !states_[id].compare_exchange_strong(active, Draining))
+    return false;
+
+  LOG(INFO) << "slave: " << id << " is draining";
+  return true;
+}
+
+void Worker::Activate(uint16_t id) {
+  // A parked slave is waiting on the exec channel, anything sent wakes it up
+  if (states_[id].exchange(Active, std::memory_order_acq_rel) == Parked)
+    Exec::InSlaves([]() {});
+  LOG(INFO) << "slave: " << id << " is active";
+}
+
+void Worker::MarkParked(uint16_t id) {
+  State draining = Draining;
+
+  if (states_[id].compare_exchange_strong(draining, Parked))
+    W_LOG(INFO) << "parked";
+}
+
+Worker::Worker(uint16_t id, uint16_t core, Type type)
     : type_(type),
+      id_(id),
       core_(core),
-      packet_pool_(&utils::Singleton<PacketPool>::instance()),
+      socket_(utils::CoreSocketId(core_).value()),
+      packet_pool_(&PacketPool::Of(socket_)),
       current_tsc_(utils::Rdtsc()) {
-  static std::atomic<uint16_t> counter = 0;
-  switch (type_) {
-    case Slave:
-      id_ = counter.fetch_add(1);
-      socket_ = CONFIG.nic.socket;
-      break;
-    case Master:
-      id_ = CONFIG.slave_cores.size();
-      socket_ = utils::CoreSocketId(core_).value();
-      break;
-    case Trivial:
-      id_ = CONFIG.slave_cores.size() + 1;
-      socket_ = utils::CoreSocketId(core_).value();
-      break;
-    default:
-      CHECK(0);
-      break;
-  }
-
   CPU_ZERO(&cpu_set_);
   CPU_SET(core_, &cpu_set_);
 }
 
 void Worker::Launch() {
+  // Ids of slaves are in the order of their cores in config, which are also
+  // those of their tx queues, master and trivial follow them
+  uint16_t slaves = CONFIG.slave_cores.size();
+  states_ = std::vector<std::atomic<State>>(slaves);
+
   master_thread_ = std::thread([=]() {
-    (new (&current_) Worker(CONFIG.master_core, Master))->run<Master>();
+    (new (&current_) Worker(slaves, CONFIG.master_core, Master))
+        ->run<Master>();
   });
 
-  for (auto core : CONFIG.slave_cores)
-    slave_threads_.emplace_back(
-        [=]() { (new (&current_) Worker(core, Slave))->run<Slave>(); });
+  for (uint16_t i = 0; i < slaves; ++i)
+    slave_threads_.emplace_back([=]() {
+      (new (&current_) Worker(i, CONFIG.slave_cores[i], Slave))->run<Slave>();
+    });
 
   trivial_thread_ = std::thread([=]() {
-    (new (&current_) Worker(CONFIG.trivial_core, Trivial))->run<Trivial>();
+    (new (&current_) Worker(slaves + 1, CONFIG.trivial_core, Trivial))
+        ->run<Trivial>();
   });
 
   internal<Master>::starting_.store(true, std::memory_order_release);
@@ -10,6 +10,10 @@ class PacketPool;
 class Worker {
  public:
   enum Type { Master = 0, Slave = 1, Trivial = 2 };
+  // Slaves but the first one of each port, which receives packets without
+  // rss on its first queue, can be parked at runtime. A draining slave takes
+  // no new flows, and is parked once its connections are gone.
+  enum State : uint8_t { Active = 0, Draining = 1, Parked = 2 };
   // This is used for static ctor
   Worker() = default;
 
@@ -40,6 +44,17 @@ class Worker {
   template <Type type>
   static void MarkAborted();
 
+  static bool Parkable(uint16_t id);
+  // Return false if slave 'id' is not parkable or not active
+  static bool Park(uint16_t id);
+  static void Activate(uint16_t id);
+  // Called by the draining slave itself
+  static void MarkParked(uint16_t id);
+
+  static State state(uint16_t id) {
+    return states_[id].load(std::memory_order_acquire);
+  }
+
   template <Type type>
   static bool starting() {
     return internal<type>::starting_.load(std::memory_order_consume);
@@ -50,7 +65,7 @@ class Worker {
   }
 
  private:
-  explicit Worker(uint16_t core, Type type);
+  explicit Worker(uint16_t id, uint16_t core, Type type);
 
   // The entry point of worker threads.
   template <Type type>
@@ -76,6 +91,8 @@ class Worker {
     static std::atomic<bool> aborting_;
   };
 
+  static std::vector<std::atomic<State>> states_;
+
   static std::vector<std::thread> slave_threads_;
   static std::thread master_thread_;
   static std::thread trivial_thread_;
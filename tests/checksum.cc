@@ -0,0 +1,437 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rte_ip.h>
+
+#include "headers/ip.h"
+#include "headers/ipv6.h"
+#include "headers/tcp.h"
+
+#include "utils/checksum.h"
+#include "utils/random.h"
+#include "utils/time.h"
+
+#include "modules/icmp_inc.h"
+#include "modules/tcp_inc.h"
+
+using namespace xlb;
+using namespace xlb::utils;
+using namespace xlb::headers;
+
+using xlb::conntrack::Tuple2;
+
+namespace {
+
+// Straightforward sum of 16-bit words as the reference
+uint16_t reference_sum(const uint8_t *buf, size_t len) {
+  uint32_t sum = 0;
+
+  for (size_t i = 0; i + 1 < len; i += 2) {
+    uint16_t word;
+    memcpy(&word, buf + i, sizeof(word));
+    sum += word;
+  }
+
+  if (len % 2) {
+    uint16_t word = 0;
+    memcpy(&word, buf + len - 1, 1);
+    sum += word;
+  }
+
+  return FoldChecksum(sum);
+}
+
+struct [[gnu::packed]] Segment {
+  Ipv4 ip;
+  Tcp tcp;
+  uint8_t payload[1460];
+};
+
+// A segment with valid checksums and a random payload
+void fill_segment(Segment *seg, Random *rd) {
+  memset(seg, 0, sizeof(Segment));
+
+  for (auto &byte : seg->payload) byte = rd->Integer();
+
+  seg->ip.version = 4;
+  seg->ip.header_length = sizeof(Ipv4) / 4;
+  seg->ip.length = be16_t(sizeof(Segment));
+  seg->ip.ttl = 64;
+  seg->ip.protocol = Ipv4::kTcp;
+  seg->ip.src = be32_t(rd->Integer());
+  seg->ip.dst = be32_t(rd->Integer());
+
+  seg->tcp.src_port = be16_t(rd->Integer());
+  seg->tcp.dst_port = be16_t(rd->Integer());
+  seg->tcp.seq_num = be32_t(rd->Integer());
+  seg->tcp.ack_num = be32_t(rd->Integer());
+  seg->tcp.offset = sizeof(Tcp) / 4;
+  seg->tcp.flags = Tcp::kAck;
+
+  seg->ip.checksum = ~CalculateSum(&seg->ip, sizeof(Ipv4));
+
+  uint32_t sum =
+      CalculatePseudoSum(seg->ip.src.raw_value(), seg->ip.dst.raw_value(),
+                         Ipv4::kTcp, sizeof(Segment) - sizeof(Ipv4));
+  sum += CalculateSum(&seg->tcp, sizeof(Segment) - sizeof(Ipv4));
+  seg->tcp.checksum = ~FoldChecksum(sum);
+}
+
+bool segment_valid(const Segment *seg) {
+  uint32_t sum =
+      CalculatePseudoSum(seg->ip.src.raw_value(), seg->ip.dst.raw_value(),
+                         Ipv4::kTcp, sizeof(Segment) - sizeof(Ipv4));
+  sum += CalculateSum(&seg->tcp, sizeof(Segment) - sizeof(Ipv4));
+
+  return CalculateSum(&seg->ip, sizeof(Ipv4)) == 0xffff &&
+         FoldChecksum(sum) == 0xffff;
+}
+
+// Rewrite addresses and ports like TcpInc does without offload
+void rewrite_segment(Segment *seg, be32_t src, be32_t dst, be16_t sport,
+                     be16_t dport) {
+  uint32_t ip_incr =
+      ChecksumIncrement32(seg->ip.src.raw_value(), src.raw_value()) +
+      ChecksumIncrement32(seg->ip.dst.raw_value(), dst.raw_value());
+  uint32_t tcp_incr =
+      ip_incr +
+      ChecksumIncrement16(seg->tcp.src_port.raw_value(), sport.raw_value()) +
+      ChecksumIncrement16(seg->tcp.dst_port.raw_value(), dport.raw_value());
+
+  seg->ip.checksum = UpdateChecksumWithIncrement(seg->ip.checksum, ip_incr);
+  seg->tcp.checksum = UpdateChecksumWithIncrement(seg->tcp.checksum, tcp_incr);
+
+  seg->ip.src = src;
+  seg->ip.dst = dst;
+  seg->tcp.src_port = sport;
+  seg->tcp.dst_port = dport;
+}
+
+// Like fill_segment, but with 'opt_len' bytes of random options and a
+// payload of 'payload_len' in 'buf'
+Ipv4 *fill_packet(uint8_t *buf, size_t opt_len, size_t payload_len,
+                  Random *rd) {
+  size_t tcp_len = sizeof(Tcp) + opt_len;
+  memset(buf, 0, sizeof(Ipv4) + sizeof(Tcp));
+
+  for (size_t i = sizeof(Ipv4) + sizeof(Tcp);
+       i < sizeof(Ipv4) + tcp_len + payload_len; i++)
+    buf[i] = rd->Integer();
+
+  auto *ip = reinterpret_cast<Ipv4 *>(buf);
+  auto *tcp = reinterpret_cast<Tcp *>(ip + 1);
+
+  ip->version = 4;
+  ip->header_length = sizeof(Ipv4) / 4;
+  ip->length = be16_t(sizeof(Ipv4) + tcp_len + payload_len);
+  ip->id = be16_t(rd->Integer());
+  ip->ttl = 64;
+  ip->protocol = Ipv4::kTcp;
+  ip->src = be32_t(rd->Integer());
+  ip->dst = be32_t(rd->Integer());
+
+  tcp->src_port = be16_t(rd->Integer());
+  tcp->dst_port = be16_t(rd->Integer());
+  tcp->seq_num = be32_t(rd->Integer());
+  tcp->offset = tcp_len / 4;
+  tcp->flags = Tcp::kSyn;
+
+  ip->checksum = ~CalculateSum(ip, sizeof(Ipv4));
+
+  uint32_t sum = CalculatePseudoSum(ip->src.raw_value(), ip->dst.raw_value(),
+                                    Ipv4::kTcp, tcp_len + payload_len);
+  sum += CalculateSum(tcp, tcp_len + payload_len);
+  tcp->checksum = ~FoldChecksum(sum);
+
+  return ip;
+}
+
+// Recompute the checksums of the packet in full, by the lengths in headers
+bool packet_valid(const Ipv4 *ip) {
+  size_t l4_len = ip->length.value() - sizeof(Ipv4);
+
+  uint32_t sum = CalculatePseudoSum(ip->src.raw_value(), ip->dst.raw_value(),
+                                    Ipv4::kTcp, l4_len);
+  sum += CalculateSum(ip + 1, l4_len);
+
+  return CalculateSum(ip, sizeof(Ipv4)) == 0xffff &&
+         FoldChecksum(sum) == 0xffff;
+}
+
+TEST(ChecksumTest, CalculateSum) {
+  Random rd;
+  std::vector<uint8_t> buf(2048);
+
+  for (auto &byte : buf) byte = rd.Integer();
+
+  // All lengths and misalignments around the vector widths
+  for (size_t off = 0; off < 8; off++)
+    for (size_t len = 0; len < 300; len++)
+      EXPECT_EQ(CalculateSum(buf.data() + off, len),
+                reference_sum(buf.data() + off, len));
+
+  EXPECT_EQ(CalculateSum(buf.data(), buf.size()),
+            reference_sum(buf.data(), buf.size()));
+}
+
+TEST(ChecksumTest, Update) {
+  Random rd;
+
+  for (int i = 0; i < 100000; i++) {
+    uint8_t buf[16];
+    for (auto &byte : buf) byte = rd.Integer();
+
+    uint16_t cksum = ~CalculateSum(buf, sizeof(buf));
+
+    uint32_t old32, new32 = rd.Integer();
+    memcpy(&old32, buf + 4, sizeof(old32));
+    memcpy(buf + 4, &new32, sizeof(new32));
+    cksum = UpdateChecksum32(cksum, old32, new32);
+
+    uint16_t old16, new16 = rd.Integer();
+    memcpy(&old16, buf + 10, sizeof(old16));
+    memcpy(buf + 10, &new16, sizeof(new16));
+    cksum = UpdateChecksum16(cksum, old16, new16);
+
+    EXPECT_EQ(cksum, static_cast<uint16_t>(~CalculateSum(buf, sizeof(buf))));
+  }
+}
+
+TEST(ChecksumTest, Rewrite) {
+  Random rd;
+  Segment seg;
+
+  for (int i = 0; i < 10000; i++) {
+    fill_segment(&seg, &rd);
+    ASSERT_TRUE(segment_valid(&seg));
+
+    rewrite_segment(&seg, be32_t(rd.Integer()), be32_t(rd.Integer()),
+                    be16_t(rd.Integer()), be16_t(rd.Integer()));
+    EXPECT_TRUE(segment_valid(&seg));
+
+    seg.payload[rd.Range(sizeof(seg.payload))] ^= 1;
+    EXPECT_FALSE(segment_valid(&seg));
+  }
+}
+
+TEST(ChecksumTest, ClampMss) {
+  Random rd;
+  uint8_t buf[1500];
+
+  for (int i = 0; i < 10000; i++) {
+    // The option at either an even or an odd offset
+    size_t nops = rd.Range(4);
+    auto *ip = fill_packet(buf, 8, rd.Range(1000), &rd);
+    auto *tcp = reinterpret_cast<Tcp *>(ip + 1);
+    auto *opt = reinterpret_cast<uint8_t *>(tcp + 1);
+
+    memset(opt, Tcp::kNop, 8);
+    opt[nops] = Tcp::kMss;
+    opt[nops + 1] = 4;
+    be16_t mss(1400 + rd.Range(200));
+    memcpy(opt + nops + 2, &mss, sizeof(mss));
+
+    // Sealed again with the options in place
+    tcp->checksum = 0;
+    uint32_t sum =
+        CalculatePseudoSum(ip->src.raw_value(), ip->dst.raw_value(),
+                           Ipv4::kTcp, ip->length.value() - sizeof(Ipv4));
+    sum += CalculateSum(tcp, ip->length.value() - sizeof(Ipv4));
+    tcp->checksum = ~FoldChecksum(sum);
+    ASSERT_TRUE(packet_valid(ip));
+
+    uint16_t clamp = 1300 + rd.Range(400);
+    modules::clamp_mss(tcp, clamp);
+    EXPECT_TRUE(packet_valid(ip));
+
+    be16_t result;
+    memcpy(&result, opt + nops + 2, sizeof(result));
+    EXPECT_EQ(result.value(), std::min(mss.value(), clamp));
+  }
+}
+
+TEST(ChecksumTest, TunnelHeader) {
+  Random rd;
+  uint8_t buf[1500];
+
+  for (int i = 0; i < 10000; i++) {
+    uint16_t gue_port = rd.Range(2) ? 6080 : 0;
+    size_t overhead = sizeof(Ipv4) + (gue_port ? sizeof(Udp) : 0);
+    auto *inner = fill_packet(buf + overhead, 0, rd.Range(1000), &rd);
+    inner->fragment_offset = be16_t(rd.Integer());
+    inner->checksum = 0;
+    inner->checksum = ~CalculateSum(inner, sizeof(Ipv4));
+
+    Tuple2 src{be32_t(rd.Integer()), be16_t(rd.Integer())};
+    be32_t dst(rd.Integer());
+
+    auto *outer = reinterpret_cast<Ipv4 *>(buf);
+    modules::fill_tunnel_header(outer, inner, src, dst, gue_port);
+
+    EXPECT_EQ(CalculateSum(outer, sizeof(Ipv4)), 0xffff);
+    EXPECT_EQ(outer->length.value(), inner->length.value() + overhead);
+    EXPECT_EQ(outer->fragment_offset.value(), inner->fragment_offset.value() &
+                                                  Ipv4::kDF);
+    EXPECT_EQ(outer->src, src.ip);
+    EXPECT_EQ(outer->dst, dst);
+    EXPECT_TRUE(packet_valid(inner));
+
+    if (gue_port) {
+      auto *udp = reinterpret_cast<Udp *>(outer + 1);
+      EXPECT_EQ(outer->protocol, Ipv4::kUdp);
+      EXPECT_EQ(udp->length.value(), inner->length.value() + sizeof(Udp));
+      EXPECT_EQ(udp->src_port, src.port);
+      EXPECT_EQ(udp->dst_port.value(), gue_port);
+    } else {
+      EXPECT_EQ(outer->protocol, Ipv4::kIpIp);
+    }
+  }
+}
+
+TEST(ChecksumTest, ToaOption) {
+  Random rd;
+  uint8_t buf[1500];
+
+  for (int i = 0; i < 10000; i++) {
+    // Up to the most options that still leave room for toa
+    size_t opt_len = rd.Range(5) * 4;
+    size_t payload_len = rd.Range(1000);
+    auto *ip = fill_packet(buf, opt_len, payload_len, &rd);
+    auto *tcp = reinterpret_cast<Tcp *>(ip + 1);
+    ASSERT_TRUE(packet_valid(ip));
+
+    // Make room behind the options as TcpInc does by shifting the headers
+    auto *payload = reinterpret_cast<uint8_t *>(tcp) + tcp->offset * 4;
+    memmove(payload + sizeof(Toa), payload, payload_len);
+
+    Tuple2 cli{be32_t(rd.Integer()), be16_t(rd.Integer())};
+    modules::append_toa_option(ip, tcp, cli);
+
+    EXPECT_TRUE(packet_valid(ip));
+    EXPECT_EQ(tcp->offset * 4, sizeof(Tcp) + opt_len + sizeof(Toa));
+    EXPECT_EQ(ip->length.value(),
+              sizeof(Ipv4) + tcp->offset * 4 + payload_len);
+
+    auto *toa = reinterpret_cast<Toa *>(payload);
+    EXPECT_EQ(toa->code, Tcp::kToa);
+    EXPECT_EQ(toa->size, sizeof(Toa));
+    EXPECT_EQ(toa->port, cli.port);
+    EXPECT_EQ(toa->addr, cli.ip);
+  }
+}
+
+TEST(ChecksumTest, IcmpInner) {
+  Random rd;
+  uint8_t buf[1500];
+
+  for (int i = 0; i < 10000; i++) {
+    size_t payload_len = rd.Range(1000);
+    auto *ip = fill_packet(buf, 0, payload_len, &rd);
+    auto *tcp = reinterpret_cast<Tcp *>(ip + 1);
+    // Errors may carry only the first 8 bytes of tcp, without the checksum
+    size_t l4_len = rd.Range(2) ? 8 : sizeof(Tcp) + payload_len;
+    uint16_t tcp_cksum = tcp->checksum;
+
+    Tuple2 src{be32_t(rd.Integer()), be16_t(rd.Integer())};
+    Tuple2 dst{be32_t(rd.Integer()), be16_t(rd.Integer())};
+    modules::rewrite_inner(ip, tcp, l4_len, src, dst);
+
+    EXPECT_EQ(ip->src, src.ip);
+    EXPECT_EQ(ip->dst, dst.ip);
+    EXPECT_EQ(tcp->src_port, src.port);
+    EXPECT_EQ(tcp->dst_port, dst.port);
+
+    if (l4_len == 8) {
+      EXPECT_EQ(CalculateSum(ip, sizeof(Ipv4)), 0xffff);
+      EXPECT_EQ(tcp->checksum, tcp_cksum);
+    } else {
+      EXPECT_TRUE(packet_valid(ip));
+    }
+  }
+}
+
+TEST(ChecksumTest, Ipv6) {
+  Random rd;
+
+  for (int i = 0; i < 10000; i++) {
+    Ipv6 ip;
+    for (auto &byte : ip.src.bytes) byte = rd.Integer();
+    for (auto &byte : ip.dst.bytes) byte = rd.Integer();
+    ip.next_header = Ipv6::kTcp;
+    ip.payload_length = be16_t(rd.Range(65536));
+
+    uint16_t sum = CalculateIpv6PseudoSum(&ip.src, &ip.dst, Ipv6::kTcp,
+                                          ip.payload_length.value());
+    EXPECT_EQ(sum, rte_ipv6_phdr_cksum(
+                       reinterpret_cast<struct ipv6_hdr *>(&ip), 0));
+
+    // Rewrite an address like TcpInc does for ipv6
+    uint16_t cksum = ~sum;
+    Ipv6::Address addr;
+    for (auto &byte : addr.bytes) byte = rd.Integer();
+    cksum = UpdateChecksumWithIncrement(
+        cksum, ChecksumIncrement128(ip.dst.bytes, addr.bytes));
+    ip.dst = addr;
+
+    EXPECT_EQ(cksum, static_cast<uint16_t>(~CalculateIpv6PseudoSum(
+                         &ip.src, &ip.dst, Ipv6::kTcp,
+                         ip.payload_length.value())));
+  }
+}
+
+// Cycles per segment of the software paths against the cpu side of the
+// offload path (pseudo header and metadata only, the rest is done by nic)
+TEST(ChecksumTest, Benchmark) {
+  constexpr int kSegments = 64;
+  constexpr int kRounds = 100000;
+  constexpr uint64_t ol_flags =
+      PKT_TX_IPV4 | PKT_TX_IP_CKSUM | PKT_TX_TCP_CKSUM;
+
+  Random rd;
+  std::vector<Segment> segs(kSegments);
+  for (auto &seg : segs) fill_segment(&seg, &rd);
+
+  auto bench = [&](const char *name, auto &&func) {
+    uint64_t start = Rdtsc();
+    for (int r = 0; r < kRounds; r++)
+      for (auto &seg : segs) func(&seg);
+    uint64_t cycles = Rdtsc() - start;
+
+    printf("%-24s %8.1f cycles/segment\n", name,
+           static_cast<double>(cycles) / (kRounds * kSegments));
+  };
+
+  bench("offload", [](Segment *seg) {
+    seg->ip.checksum = 0;
+    seg->tcp.checksum = 0;
+    seg->tcp.checksum = rte_ipv4_phdr_cksum(
+        reinterpret_cast<struct ipv4_hdr *>(&seg->ip), ol_flags);
+  });
+
+  for (auto &seg : segs) fill_segment(&seg, &rd);
+
+  bench("incremental", [&](Segment *seg) {
+    rewrite_segment(seg, seg->ip.dst, seg->ip.src, seg->tcp.dst_port,
+                    seg->tcp.src_port);
+  });
+
+  for (auto &seg : segs) EXPECT_TRUE(segment_valid(&seg));
+
+  bench("software validation", [](Segment *seg) {
+    asm volatile("" : : "r"(segment_valid(seg)));
+  });
+
+  bench("scalar validation", [](Segment *seg) {
+    uint32_t sum = reference_sum(reinterpret_cast<uint8_t *>(&seg->tcp),
+                                 sizeof(Segment) - sizeof(Ipv4));
+    asm volatile("" : : "r"(sum));
+  });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
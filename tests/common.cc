@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+
+#include "utils/common.h"
+
+namespace {
+
+uint64_t sum_of_parts(uint64_t total, uint64_t parts) {
+  uint64_t sum = 0;
+  for (uint64_t i = 0; i < parts; ++i) sum += split_evenly(total, parts, i);
+  return sum;
+}
+
+}  // namespace
+
+// Such as the limit of connections of rs shared by slaves
+TEST(CommonTest, SplitEvenly) {
+  // Less than the parts, none of the first ones is left with 0
+  EXPECT_EQ(split_evenly(8, 16, 0), 1);
+  EXPECT_EQ(split_evenly(8, 16, 7), 1);
+  EXPECT_EQ(split_evenly(8, 16, 8), 0);
+  EXPECT_EQ(sum_of_parts(8, 16), 8);
+
+  EXPECT_EQ(split_evenly(35, 8, 2), 5);
+  EXPECT_EQ(split_evenly(35, 8, 3), 4);
+  EXPECT_EQ(sum_of_parts(35, 8), 35);
+
+  EXPECT_EQ(sum_of_parts(0, 4), 0);
+  EXPECT_EQ(sum_of_parts(1000, 1), 1000);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
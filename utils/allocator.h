@@ -5,7 +5,7 @@
 
 namespace xlb {
 
-#define ALLOC (&utils::UnsafeSingleton<utils::MemoryResource>::instance())
+#define ALLOC (utils::MemoryResource::Current())
 
 }  // namespace xlb
 
@@ -58,12 +58,27 @@ class Allocator {
 // Stateful allocator support in std is like a shit, so we use pmr in C++ 17.
 // Fortunately, the frequency of calling allocate/do_allocate is not very high
 // in our project, so we can bear the overhead of a virtual function.
+//
+// There is one for each socket. A thread allocates from the default one until
+// it is bound to its own socket.
 class MemoryResource : public std::experimental::pmr::memory_resource {
  public:
   explicit MemoryResource(int socket) : socket_(socket) {}
 
   int socket() const { return socket_; }
 
+  static MemoryResource *Current() {
+    return current_ ? current_ : default_;
+  }
+
+  static void Init(int socket) {
+    for (int i = 0; i < RTE_MAX_NUMA_NODES; ++i)
+      sockets_[i] = new MemoryResource(i);
+    default_ = sockets_[socket];
+  }
+
+  static void Bind(int socket) { current_ = sockets_[socket]; }
+
  protected:
   void *do_allocate(std::size_t bytes, std::size_t alignment) override {
     F_DVLOG(2) << "bytes: " << bytes << " alignment: " << alignment;
@@ -81,13 +96,18 @@ class MemoryResource : public std::experimental::pmr::memory_resource {
     rte_free(p);
   }
 
+  // Memory of any socket is freed in the same way
   bool do_is_equal(const pmr::memory_resource &other) const noexcept override {
-    return this == &other;
+    return dynamic_cast<const MemoryResource *>(&other) != nullptr;
   }
 
  private:
   int socket_;
 
+  static inline MemoryResource *sockets_[RTE_MAX_NUMA_NODES];
+  static inline MemoryResource *default_;
+  static inline thread_local MemoryResource *current_;
+
   friend struct INew;
 };
 
@@ -108,9 +128,10 @@ struct INew {
   static void operator delete[](void *ptr) { ALLOC->do_deallocate(ptr, 0, 0); }
 };
 
-inline void InitDefaultAllocator(int socket) {
-  UnsafeSingleton<MemoryResource>::Init(socket);
-}
+inline void InitDefaultAllocator(int socket) { MemoryResource::Init(socket); }
+
+// Allocate from 'socket' in the current thread afterwards
+inline void BindAllocator(int socket) { MemoryResource::Bind(socket); }
 
 template <typename T, typename... Args>
 inline std::shared_ptr<T> make_shared(Args &&... args) {
@@ -43,13 +43,11 @@ class [[gnu::packed]] bitset {
 // TODO: add support for shifting at bit granularity
 // Shifts `buf` to the left by `len` bytes and fills in with zeroes using
 // std::memmove() and std::memset().
-/*
 inline void ShiftBytesLeftSmall(uint8_t *buf, const size_t len, size_t shift) {
   shift = std::min(shift, len);
   memmove(buf, buf + shift, len - shift);
   memset(buf + len - shift, 0, shift);
 }
- */
 
 // TODO: add support for shifting at bit granularity
 // Shifts `buf` to the left by `len` bytes and fills in with zeroes.
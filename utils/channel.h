@@ -1,5 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
 #include "utils/boost.h"
 #include "utils/common.h"
 #include "utils/lock_less_queue.h"
@@ -18,26 +22,34 @@ class Channel {
   template <typename G>
   static void Register(size_t size) {
     // This is safe since 'Init' will judge whether it is null
-    auto *ring = &UnsafeSingletonTLS<Ring>::Init(size);
+    auto *box = &UnsafeSingletonTLS<Mailbox>::Init(size);
 
     std::lock_guard guard(internal<G>::lock);
-    if (any_of_equal(internal<G>::rings, ring)) return;
+    if (any_of_equal(internal<G>::boxes, box)) return;
 
-    internal<G>::rings.emplace_back(ring);
+    internal<G>::boxes.emplace_back(box);
   }
 
   // TODO: unregister...
 
   template <typename G>
   static void Send(Ptr sp) {
-    for (auto &r : internal<G>::rings) {
+    for (auto &b : internal<G>::boxes) {
       auto *spp = new Ptr(sp);
       for (;;) {
-        if (r->Push(spp))
+        if (b->ring.Push(spp))
           break;
         else
           LOG(WARNING) << "channel is full, retrying";
       }
+
+      // Pairs with the order in 'Wait', so that either the receiver sees the
+      // pushed or it is notified
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (b->waiting.load(std::memory_order_relaxed)) {
+        std::lock_guard guard(b->lock);
+        b->cond.notify_one();
+      }
     }
   }
 
@@ -64,7 +76,7 @@ class Channel {
   static Ptr Recv() {
     Ptr *spp;
     // Calling 'Recv' in unregistered thread is undefined behavior
-    auto &ring = UnsafeSingletonTLS<Ring>::instance();
+    auto &ring = UnsafeSingletonTLS<Mailbox>::instance().ring;
     if (!ring.Pop(spp)) return {};
 
     Ptr sp = *spp;
@@ -73,13 +85,38 @@ class Channel {
     return sp;
   }
 
+  // Block until something is sent to the ring of the calling thread or
+  // 'timeout' passes, for threads with nothing else to do. Return at once if
+  // the ring is not empty.
+  template <typename Rep, typename Period>
+  static void Wait(const std::chrono::duration<Rep, Period> &timeout) {
+    auto &box = UnsafeSingletonTLS<Mailbox>::instance();
+    std::unique_lock guard(box.lock);
+
+    box.waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    box.cond.wait_for(guard, timeout, [&box]() { return !box.ring.Empty(); });
+    box.waiting.store(false, std::memory_order_relaxed);
+  }
+
  private:
   // Since calling 'Recv' will only read the thread local ring
   using Ring = LockLessQueue<Ptr *, false, true>;
 
+  // Senders only take the lock to wake up a waiting receiver
+  struct Mailbox {
+    explicit Mailbox(size_t size) : ring(size) {}
+
+    Ring ring;
+    std::atomic<bool> waiting{false};
+    std::mutex lock;
+    std::condition_variable cond;
+  };
+
   template <typename G>
   struct internal {
-    static vector<Ring *> rings;
+    static vector<Mailbox *> boxes;
     static std::mutex lock;
   };
 
@@ -88,8 +125,8 @@ class Channel {
 
 template <typename T, typename Tag>
 template <typename G>
-vector<typename Channel<T, Tag>::Ring *> Channel<T, Tag>::internal<G>::rings =
-    {};
+vector<typename Channel<T, Tag>::Mailbox *>
+    Channel<T, Tag>::internal<G>::boxes = {};
 
 template <typename T, typename Tag>
 template <typename G>
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "utils/common.h"
+
+namespace xlb::utils {
+
+// All checksums here are in network order and all values are taken as they
+// are in the packet, since the ones' complement sum is independent of byte
+// order as long as it is consistent.
+
+// Fold a 32-bit ones' complement sum into 16 bits (not inverted)
+inline uint16_t FoldChecksum(uint32_t sum) {
+  sum = (sum & 0xffff) + (sum >> 16);
+  sum = (sum & 0xffff) + (sum >> 16);
+  return static_cast<uint16_t>(sum);
+}
+
+// Fold a 64-bit ones' complement sum of 32-bit words into 16 bits
+inline uint16_t FoldChecksum(uint64_t sum) {
+  sum = (sum & 0xffffffff) + (sum >> 32);
+  sum = (sum & 0xffffffff) + (sum >> 32);
+  return FoldChecksum(static_cast<uint32_t>(sum));
+}
+
+// Update the checksum when a 16-bit word changes from 'old_val' to 'new_val',
+// HC' = ~(~HC + ~m + m') (RFC 1624, Eqn. 3)
+inline uint16_t UpdateChecksum16(uint16_t cksum, uint16_t old_val,
+                                 uint16_t new_val) {
+  uint32_t sum = static_cast<uint16_t>(~cksum);
+  sum += static_cast<uint16_t>(~old_val);
+  sum += new_val;
+  return ~FoldChecksum(sum);
+}
+
+// Same as above for a 32-bit word
+inline uint16_t UpdateChecksum32(uint16_t cksum, uint32_t old_val,
+                                 uint32_t new_val) {
+  uint64_t sum = static_cast<uint16_t>(~cksum);
+  sum += static_cast<uint32_t>(~old_val);
+  sum += new_val;
+  return ~FoldChecksum(sum);
+}
+
+// Update the checksum with the sum of the differences of several words which
+// is accumulated by 'ChecksumIncrement*()', so a checksum is touched once for
+// many changed fields
+inline uint16_t UpdateChecksumWithIncrement(uint16_t cksum, uint32_t incr) {
+  uint32_t sum = static_cast<uint16_t>(~cksum);
+  sum += FoldChecksum(incr);
+  return ~FoldChecksum(sum);
+}
+
+// Difference between two 16-bit words, to be accumulated in a 32-bit sum
+inline uint32_t ChecksumIncrement16(uint16_t old_val, uint16_t new_val) {
+  return static_cast<uint16_t>(~old_val) + static_cast<uint32_t>(new_val);
+}
+
+// Difference between two 32-bit words, to be accumulated in a 32-bit sum
+inline uint32_t ChecksumIncrement32(uint32_t old_val, uint32_t new_val) {
+  uint64_t sum = static_cast<uint32_t>(~old_val);
+  sum += new_val;
+  return FoldChecksum(sum);
+}
+
+// Difference between two 128-bit words (e.g. ipv6 addresses), to be
+// accumulated in a 32-bit sum
+inline uint32_t ChecksumIncrement128(const void *old_val, const void *new_val) {
+  uint64_t old_words[2], new_words[2];
+  memcpy(old_words, old_val, sizeof(old_words));
+  memcpy(new_words, new_val, sizeof(new_words));
+
+  uint64_t sum = 0;
+  for (int i = 0; i < 2; i++) {
+    uint64_t inverted = ~old_words[i];
+    sum += (inverted & 0xffffffff) + (inverted >> 32);
+    sum += (new_words[i] & 0xffffffff) + (new_words[i] >> 32);
+  }
+
+  return FoldChecksum(sum);
+}
+
+namespace internal {
+
+// Built for avx2 regardless of the flags of the build, so it is only called
+// if the cpu supports it
+inline bool has_avx2() {
+  static const bool ret =
+      (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+  return ret;
+}
+
+// Sum of the blocks of 64 bytes, 'p' and 'len' are advanced past them
+[[gnu::target("avx2")]] inline uint64_t sum_avx2(const uint8_t *&p,
+                                                 size_t &len) {
+  // 32-bit words are zero extended into 64-bit lanes, so carries are kept
+  // until the final fold. Two accumulators hide the latency of the adds.
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i acc0 = zero;
+  __m256i acc1 = zero;
+
+  for (; len >= 64; len -= 64, p += 64) {
+    __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32));
+
+    acc0 = _mm256_add_epi64(acc0, _mm256_unpacklo_epi32(v0, zero));
+    acc1 = _mm256_add_epi64(acc1, _mm256_unpackhi_epi32(v0, zero));
+    acc0 = _mm256_add_epi64(acc0, _mm256_unpacklo_epi32(v1, zero));
+    acc1 = _mm256_add_epi64(acc1, _mm256_unpackhi_epi32(v1, zero));
+  }
+
+  __m256i acc = _mm256_add_epi64(acc0, acc1);
+  __m128i acc128 = _mm_add_epi64(_mm256_castsi256_si128(acc),
+                                 _mm256_extracti128_si256(acc, 1));
+  return uint64_t(_mm_cvtsi128_si64(acc128)) +
+         uint64_t(_mm_extract_epi64(acc128, 1));
+}
+
+}  // namespace internal
+
+// Ones' complement sum of a buffer folded into 16 bits (not inverted), the
+// checksum of a buffer is the inversion and a buffer with a valid checksum
+// sums to 0xffff
+inline uint16_t CalculateSum(const void *buf, size_t len) {
+  auto *p = static_cast<const uint8_t *>(buf);
+  uint64_t sum = 0;
+
+  if (len >= 64 && internal::has_avx2()) sum += internal::sum_avx2(p, len);
+
+  for (; len >= 8; len -= 8, p += 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    sum += (word & 0xffffffff) + (word >> 32);
+  }
+
+  if (len >= 4) {
+    uint32_t word;
+    memcpy(&word, p, sizeof(word));
+    sum += word;
+    len -= 4;
+    p += 4;
+  }
+
+  if (len >= 2) {
+    uint16_t word;
+    memcpy(&word, p, sizeof(word));
+    sum += word;
+    len -= 2;
+    p += 2;
+  }
+
+  // The odd byte is padded with zero at its end
+  if (len) {
+    uint16_t word = 0;
+    memcpy(&word, p, 1);
+    sum += word;
+  }
+
+  return FoldChecksum(sum);
+}
+
+// Sum of the ipv4 pseudo header, 'src' and 'dst' are in network order while
+// 'proto' and 'len' (of the l4 segment) are in host order
+inline uint16_t CalculatePseudoSum(uint32_t src, uint32_t dst, uint8_t proto,
+                                   uint16_t len) {
+  uint64_t sum = src;
+  sum += dst;
+  sum += htons(proto);
+  sum += htons(len);
+  return FoldChecksum(sum);
+}
+
+// Sum of the ipv6 pseudo header, 'src' and 'dst' point to the addresses in
+// the packet while 'proto' and 'len' (of the l4 segment) are in host order
+inline uint16_t CalculateIpv6PseudoSum(const void *src, const void *dst,
+                                       uint8_t proto, uint32_t len) {
+  uint32_t sum = CalculateSum(src, 16);
+  sum += CalculateSum(dst, 16);
+  sum += htons(proto);
+  len = htonl(len);
+  sum += (len & 0xffff) + (len >> 16);
+  return FoldChecksum(sum);
+}
+
+}  // namespace xlb::utils
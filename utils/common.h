@@ -115,6 +115,13 @@ static inline uint64_t align_ceil_pow2(uint64_t v) {
   return v + 1;
 }
 
+// Part 'index' of 'total' split into 'parts', the remainder goes to the first
+// ones so that all of them add up to 'total'
+static inline uint64_t split_evenly(uint64_t total, uint64_t parts,
+                                    uint64_t index) {
+  return total / parts + (index < total % parts ? 1 : 0);
+}
+
 #define __cacheline_aligned __attribute__((aligned(64)))
 
 /* For x86_64. DMA operations are not safe with these macros */
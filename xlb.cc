@@ -30,7 +30,10 @@ int main(int argc, char **argv) {
 
   Module::Init<ArpInc>();
   Module::Init<Ipv4Inc>();
+  Module::Init<Ipv6Inc>();
   Module::Init<TcpInc>();
+  Module::Init<UdpInc>();
+  Module::Init<IcmpInc>();
 //  Module::Init<CSum>();
 
   //  Module::Init<Conntrack>();
@@ -11,10 +11,13 @@
 #include "modules/arp_inc.h"
 #include "modules/ether_inc.h"
 #include "modules/ether_out.h"
+#include "modules/icmp_inc.h"
 #include "modules/ipv4_inc.h"
+#include "modules/ipv6_inc.h"
 #include "modules/port_inc.h"
 #include "modules/port_out.h"
 #include "modules/tcp_inc.h"
+#include "modules/udp_inc.h"
 
 #include "runtime/config.h"
 #include "runtime/dpdk.h"